@@ -32,7 +32,7 @@ namespace
 		uint64_t i;
 
 		static double dtUsed = 0.0;
-		static scp::Matrix<double> Kx(Nx, Nx, 0.0), Ky(Ny, Ny, 0.0);
+		static scp::Vector<double> KxDiagonal(Nx), KxOffDiagonal(Nx), KyDiagonal(Ny), KyOffDiagonal(Ny);
 
 		bool dtChanged = false;
 		if (dt > dtUsed * 1.2)
@@ -51,63 +51,45 @@ namespace
 
 		if (dtChanged)
 		{
+			// Kx and Ky are periodic tridiagonal matrices
+
 			for (i = 0; i < Nx; i++)
 			{
-				Kx[{i, i}] = 1 + (2 * kappa * dtUsed) / (dx * dx);
-				Kx[{(i + 1) % Nx, i}] = -(kappa * dtUsed) / (dx * dx);
-				Kx[{i, (i + 1) % Nx}] = -(kappa * dtUsed) / (dx * dx);
+				KxDiagonal[i] = 1 + (2 * kappa * dtUsed) / (dx * dx);
+				KxOffDiagonal[i] = -(kappa * dtUsed) / (dx * dx);
 			}
-			Kx.inverse();
 
 			for (i = 0; i < Ny; i++)
 			{
-				Ky[{i, i}] = 1 + (2 * kappa * dtUsed) / (dy * dy);
-				Ky[{(i + 1) % Ny, i}] = -(kappa * dtUsed) / (dy * dy);
-				Ky[{i, (i + 1) % Ny}] = -(kappa * dtUsed) / (dy * dy);
+				KyDiagonal[i] = 1 + (2 * kappa * dtUsed) / (dy * dy);
+				KyOffDiagonal[i] = -(kappa * dtUsed) / (dy * dy);
 			}
-			Ky.inverse();
 		}
 
-		double c;
+		scp::Matrix<double> WAdvected(Ny, Nx);
 
+		const auto advection = [](double step)
 		{
-			scp::Vector<double> WCopy(Nx), WCopyCopy(Nx);
-			for (i = 0; i < Ny; i++)
+			return [=](double w, double wNext, double wPrevious, double u, double, double uPrevious)
 			{
-				for (uint64_t k = 0; k < Nx; ++k)
-				{
-					c = Ux[{i, k}] * dtUsed / dx;
-					WCopy[k] = (1.0 - c * c) * W[{i, k}] + (c / 2) * (c - 1) * W[{ i, (k + 1) % Nx }];
-					c = Ux[{ i, (Nx + k - 1) % Nx }] * dtUsed / dx;
-					WCopy[k] += (c / 2) * (1 + c) * W[{i, (Nx + k - 1) % Nx}];
-				}
+				const double c = u * dtUsed / step;
+				const double cPrevious = uPrevious * dtUsed / step;
+				return (1.0 - c * c) * w + (c / 2) * (c - 1) * wNext + (cPrevious / 2) * (1 + cPrevious) * wPrevious;
+			};
+		};
 
-				WCopy = Kx * WCopy;
-				for (uint64_t k = 0; k < Nx; ++k)
-				{
-					W[{i, k}] = WCopy[k];
-				}
-			}
+		{
+			scp::stencil<scp::BorderBehaviour::Periodic, scp::StencilOffset<0, 0>, scp::StencilOffset<0, 1>, scp::StencilOffset<0, -1>>(WAdvected, advection(dx), W, Ux);
+
+			scp::solveCyclicTridiagonal(KxOffDiagonal, KxDiagonal, KxOffDiagonal, WAdvected, 1);
+			W = WAdvected;
 		}
 
 		{
-			scp::Vector<double> WCopy(Ny), WCopyCopy(Ny);
-			for (i = 0; i < Nx; i++)
-			{
-				for (uint64_t k = 0; k < Ny; ++k)
-				{
-					c = Uy[{k, i}] * dtUsed / dy;
-					WCopy[k] = (1.0 - c * c) * W[{k, i}] + (c / 2) * (c - 1) * W[{(k + 1) % Ny, i}];
-					c = Uy[{(Ny + k - 1) % Ny, i}] * dtUsed / dy;
-					WCopy[k] += (c / 2) * (1 + c) * W[{(Ny + k - 1) % Ny, i}];
-				}
+			scp::stencil<scp::BorderBehaviour::Periodic, scp::StencilOffset<0, 0>, scp::StencilOffset<1, 0>, scp::StencilOffset<-1, 0>>(WAdvected, advection(dy), W, Uy);
 
-				WCopy = Ky * WCopy;
-				for (uint64_t k = 0; k < Ny; ++k)
-				{
-					W[{k, i}] = WCopy[k];
-				}
-			}
+			scp::solveCyclicTridiagonal(KyOffDiagonal, KyDiagonal, KyOffDiagonal, WAdvected, 0);
+			W = WAdvected;
 		}
 
 		return dtUsed;
@@ -117,23 +99,17 @@ namespace
 	{
 		const uint64_t Nx = W.getSize(1);
 		const uint64_t Ny = W.getSize(0);
-		const uint64_t N = Nx * Ny;
+		const uint64_t NxHat = Nx / 2 + 1;
+
+		// W is real, so only the first Nx/2+1 columns of its spectrum are stored
 
-		scp::Matrix<std::complex<double>> WHat(Ny, Nx);
-		std::copy(W.cbegin(), W.cend(), WHat.begin());
-		WHat.fft();
+		scp::Matrix<std::complex<double>> WHat(Ny, NxHat);
+		W.rfft(WHat);
 
-		scp::Vector<std::complex<double>> kx(Nx), ky(Ny);
-		for (uint64_t i = 0; i < Nx; ++i)
+		scp::Vector<std::complex<double>> kx(NxHat), ky(Ny);
+		for (uint64_t i = 0; i < NxHat; ++i)
 		{
-			if (i < (Nx + 1) / 2)
-			{
-				kx[i] = std::complex<double>(0, 2 * std::numbers::pi * i / Lx);
-			}
-			else
-			{
-				kx[i] = std::complex<double>(0, 2 * std::numbers::pi * (Nx - i) / Lx);
-			}
+			kx[i] = std::complex<double>(0, 2 * std::numbers::pi * i / Lx);
 		}
 
 		for (uint64_t i = 0; i < Ny; ++i)
@@ -148,11 +124,15 @@ namespace
 			}
 		}
 
-		scp::Matrix<std::complex<double>> UxHat(Ny, Nx), UyHat(Ny, Nx);
+		// The velocities are the imaginary parts of the inverse transforms of -WHat.ky/k and WHat.kx/k, which are
+		// the real parts of the inverse transforms of the same spectra multiplied by -i
+
+		const std::complex<double> minusI(0, -1);
+		scp::Matrix<std::complex<double>> UxHat(Ny, NxHat), UyHat(Ny, NxHat);
 
 		for (uint64_t i(0); i < Ny; i++)
 		{
-			for (uint64_t j(0); j < Nx; j++)
+			for (uint64_t j(0); j < NxHat; j++)
 			{
 				if (i == 0 && j == 0)
 				{
@@ -161,23 +141,14 @@ namespace
 				}
 				else
 				{
-					UxHat[{i, j}] = -WHat[{i, j}] * ky[i] / (kx[j] * kx[j] + ky[i] * ky[i]);
-					UyHat[{i, j}] = WHat[{i, j}] * kx[j] / (kx[j] * kx[j] + ky[i] * ky[i]);
+					UxHat[{i, j}] = -WHat[{i, j}] * ky[i] * minusI / (kx[j] * kx[j] + ky[i] * ky[i]);
+					UyHat[{i, j}] = WHat[{i, j}] * kx[j] * minusI / (kx[j] * kx[j] + ky[i] * ky[i]);
 				}
 			}
 		}
 
-		UxHat.ifft();
-		UyHat.ifft();
-
-		for (uint64_t i = 0; i < Ny; ++i)
-		{
-			for (uint64_t j = 0; j < Nx; ++j)
-			{
-				Ux[{i, j}] = UxHat[{i, j}].imag();
-				Uy[{i, j}] = UyHat[{i, j}].imag();
-			}
-		}
+		UxHat.irfft(Ux);
+		UyHat.irfft(Uy);
 	}
 }
 
@@ -27,6 +27,10 @@ int main()
 	// std::cout << "Sqrt(2): " << squareRoot(2, 500).decimals(500) << std::endl;
 	// std::cout << "Phi: " << ((1 + squareRoot(5, 500)) / 2).decimals(500) << std::endl;
 
+	scp::ThreadPool pool;
+	scp::exec.dispatcher = pool.getDispatcher();
+	scp::exec.concurrency = pool.getThreadCount();
+
 	simuFluide2D("build/fluid/", 512, 512);
 	// lennardJones2D("build/moledyn/", 200);
 
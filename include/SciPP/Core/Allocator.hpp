@@ -0,0 +1,135 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//! \file
+//! \author Plgrin Marius
+//! \copyright The MIT License (MIT)
+//! \date 2019-2024
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <SciPP/Core/CoreTypes.hpp>
+
+namespace scp
+{
+	// Source of the memory of tensor values. deallocate receives the size and alignment given to allocate. Tensors
+	// remember the allocator their values come from, so the current allocator can be changed at any time, but an
+	// allocator must outlive the tensors it allocated. It must be thread-safe if tensors are created concurrently.
+
+	class TensorAllocator
+	{
+		public:
+
+			virtual void* allocate(uint64_t size, uint64_t alignment) = 0;
+			virtual void deallocate(void* memory, uint64_t size, uint64_t alignment) = 0;
+
+			virtual ~TensorAllocator() = default;
+	};
+
+	class AlignedAllocator final : public TensorAllocator
+	{
+		public:
+
+			void* allocate(uint64_t size, uint64_t alignment) override;
+			void deallocate(void* memory, uint64_t size, uint64_t alignment) override;
+	};
+
+	// Keeps released blocks, rounded up to a power of two, to serve the next allocations of the same size class without
+	// going back to the upstream allocator. Useful when tensors of the same shapes are created at every time step.
+
+	class PoolAllocator final : public TensorAllocator
+	{
+		public:
+
+			PoolAllocator();
+			PoolAllocator(TensorAllocator& upstream);
+			PoolAllocator(const PoolAllocator& allocator) = delete;
+			PoolAllocator(PoolAllocator&& allocator) = delete;
+
+			PoolAllocator& operator=(const PoolAllocator& allocator) = delete;
+			PoolAllocator& operator=(PoolAllocator&& allocator) = delete;
+
+			void* allocate(uint64_t size, uint64_t alignment) override;
+			void deallocate(void* memory, uint64_t size, uint64_t alignment) override;
+
+			// Gives all the kept blocks back to the upstream allocator
+			void release();
+
+			~PoolAllocator() override;
+
+		private:
+
+			static uint64_t _getBlockSize(uint64_t size);
+
+			TensorAllocator* _upstream;
+			std::mutex _mutex;
+			std::map<std::pair<uint64_t, uint64_t>, std::vector<void*>> _blocks;
+	};
+
+	// Maps allocations of at least threshold bytes directly, aligned on 2 MiB and advised as transparent huge pages
+	// (madvise MADV_HUGEPAGE) to reduce TLB misses on large fields. If reserved is true, reserved huge pages
+	// (MAP_HUGETLB) are tried first. Smaller allocations, and all allocations on systems other than Linux, use the
+	// default allocator.
+
+	class HugePageAllocator final : public TensorAllocator
+	{
+		public:
+
+			HugePageAllocator(uint64_t threshold = _hugePageSize, bool reserved = false);
+
+			void* allocate(uint64_t size, uint64_t alignment) override;
+			void deallocate(void* memory, uint64_t size, uint64_t alignment) override;
+
+		private:
+
+			static constexpr uint64_t _hugePageSize = 1 << 21;
+
+			uint64_t _threshold;
+			bool _reserved;
+	};
+
+	inline AlignedAllocator defaultTensorAllocator;
+	inline TensorAllocator* tensorAllocator = &defaultTensorAllocator;
+
+	// While enabled, the values of new tensors are reference counted, and copying such a tensor shares its values
+	// instead of duplicating them until one of the copies is written to. Any non-const access (operator[], get, set...)
+	// counts as a write and first gives the tensor its own values, so references returned by operator[] and get must
+	// not be kept across a copy. Taking a mutable pointer (getData, begin, end) or a mutable TensorView marks the values
+	// as unshareable: they are not reference counted anymore and every later copy of the tensor is a deep copy.
+
+	inline bool tensorCopyOnWrite = false;
+
+	// Counts of tensor copies since the last reset, deferred copies being the ones made at the first write into
+	// shared values. If set, the callback is called at each deep copy, for instance to log or break on large ones.
+
+	struct TensorCopyStatistics
+	{
+		uint64_t deepCopies;
+		uint64_t deferredCopies;
+		uint64_t sharedCopies;
+		uint64_t copiedBytes;
+	};
+
+	TensorCopyStatistics getTensorCopyStatistics();
+	void resetTensorCopyStatistics();
+
+	inline void (*tensorDeepCopyCallback)(const TensorShape& shape, uint64_t size, bool deferred) = nullptr;
+
+	namespace _scp
+	{
+		// Alignment of tensor values, suitable for any SIMD load
+		constexpr uint64_t tensorAlignment = 64;
+
+		struct TensorCopyCounters
+		{
+			std::atomic<uint64_t> deepCopies;
+			std::atomic<uint64_t> deferredCopies;
+			std::atomic<uint64_t> sharedCopies;
+			std::atomic<uint64_t> copiedBytes;
+		};
+
+		inline TensorCopyCounters tensorCopyCounters;
+
+		void countTensorDeepCopy(const TensorShape& shape, uint64_t size, bool deferred);
+		void countTensorSharedCopy();
+	}
+}
@@ -0,0 +1,151 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//! \file
+//! \author Plgrin Marius
+//! \copyright The MIT License (MIT)
+//! \date 2019-2024
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <SciPP/Core/CoreTypes.hpp>
+
+namespace scp
+{
+	// Square matrix whose non-zero values lie within lowerBandwidth diagonals below the main one and upperBandwidth
+	// above it. Row i of the bands stores the columns i - lowerBandwidth to i + upperBandwidth, so that each row of the
+	// matrix is contiguous. The band values falling out of the matrix, in the corners, are kept at zero.
+
+	template<typename TValue>
+	class BandedMatrix
+	{
+		public:
+
+			using ValueType = TValue;
+
+			// Construction, copy and move operations
+
+			constexpr BandedMatrix(uint64_t size, uint64_t lowerBandwidth, uint64_t upperBandwidth);
+			constexpr BandedMatrix(uint64_t size, uint64_t lowerBandwidth, uint64_t upperBandwidth, const TValue& value);
+			constexpr BandedMatrix(const Matrix<TValue>& matrix, uint64_t lowerBandwidth, uint64_t upperBandwidth);
+			constexpr BandedMatrix(const BandedMatrix<TValue>& matrix) = default;
+			constexpr BandedMatrix(BandedMatrix<TValue>&& matrix) = default;
+
+			constexpr BandedMatrix<TValue>& operator=(const BandedMatrix<TValue>& matrix) = default;
+			constexpr BandedMatrix<TValue>& operator=(BandedMatrix<TValue>&& matrix) = default;
+
+			// result = this.vector
+
+			constexpr void vectorProduct(const Vector<TValue>& vector, Vector<TValue>& result) const;
+
+			// Computation-free getters and setters, values out of the band are zero and cannot be set
+
+			constexpr bool isInBand(uint64_t i, uint64_t j) const;
+			constexpr const TValue& get(uint64_t i, uint64_t j) const;
+			constexpr void set(uint64_t i, uint64_t j, const TValue& value);
+
+			constexpr uint64_t getSize() const;
+			constexpr uint64_t getLowerBandwidth() const;
+			constexpr uint64_t getUpperBandwidth() const;
+			constexpr const Matrix<TValue>& getBands() const;
+			constexpr Matrix<TValue>& getBands();
+
+			// Destructor
+
+			constexpr ~BandedMatrix() = default;
+
+		private:
+
+			constexpr void _clearCorners();
+
+			static constexpr TValue _zero = 0;
+
+			uint64_t _size;
+			uint64_t _lowerBandwidth;
+			uint64_t _upperBandwidth;
+			Matrix<TValue> _bands;
+	};
+
+	template<typename TValue>
+	Vector<TValue> operator*(const BandedMatrix<TValue>& matrix, const Vector<TValue>& vector);
+
+	// LU factorization of a banded matrix with partial pivoting. Row swaps can bring up to lowerBandwidth more
+	// diagonals above the main one, so U has lowerBandwidth + upperBandwidth of them. As in LAPACK, L is not stored as a
+	// triangular matrix but as the row swaps and eliminations applied in order, its multipliers staying where they
+	// were computed. Solving with a singular matrix throws.
+
+	template<typename TValue>
+	class BandedLU
+	{
+		public:
+
+			// Construction, copy and move operations
+
+			constexpr BandedLU(const BandedMatrix<TValue>& matrix);
+			constexpr BandedLU(const BandedLU<TValue>& lu) = default;
+			constexpr BandedLU(BandedLU<TValue>&& lu) = default;
+
+			constexpr BandedLU<TValue>& operator=(const BandedLU<TValue>& lu) = default;
+			constexpr BandedLU<TValue>& operator=(BandedLU<TValue>&& lu) = default;
+
+			// Solves A.x = b in place, each column of B being a right-hand side
+
+			constexpr void solve(Vector<TValue>& b) const;
+			constexpr void solve(Matrix<TValue>& B) const;
+
+			constexpr TValue determinant() const;
+			constexpr bool isSingular() const;
+
+			constexpr const BandedMatrix<TValue>& getFactors() const;
+			constexpr const uint64_t* getPivots() const;
+
+			// Destructor
+
+			constexpr ~BandedLU() = default;
+
+		private:
+
+			constexpr void _solve(TValue* x, uint64_t count) const;
+
+			uint64_t _lowerBandwidth;
+			BandedMatrix<TValue> _factors;
+			std::vector<uint64_t> _pivots;
+			_scp::LUStatus _status;
+	};
+
+	// Cholesky factorization A = L.LT of a symmetric positive definite banded matrix, of which only the lower band is
+	// read. L keeps the lower bandwidth of A. The constructor throws if the matrix is not positive definite.
+
+	template<typename TValue>
+	class BandedCholesky
+	{
+		public:
+
+			// Construction, copy and move operations
+
+			constexpr BandedCholesky(const BandedMatrix<TValue>& matrix);
+			constexpr BandedCholesky(const BandedCholesky<TValue>& cholesky) = default;
+			constexpr BandedCholesky(BandedCholesky<TValue>&& cholesky) = default;
+
+			constexpr BandedCholesky<TValue>& operator=(const BandedCholesky<TValue>& cholesky) = default;
+			constexpr BandedCholesky<TValue>& operator=(BandedCholesky<TValue>&& cholesky) = default;
+
+			// Solves A.x = b in place, each column of B being a right-hand side
+
+			constexpr void solve(Vector<TValue>& b) const;
+			constexpr void solve(Matrix<TValue>& B) const;
+
+			constexpr TValue determinant() const;
+
+			constexpr const BandedMatrix<TValue>& getFactor() const;
+
+			// Destructor
+
+			constexpr ~BandedCholesky() = default;
+
+		private:
+
+			constexpr void _solve(TValue* x, uint64_t count) const;
+
+			BandedMatrix<TValue> _factor;
+	};
+}
@@ -19,9 +19,24 @@
 #include <SciPP/Core/templates/Rational.hpp>
 #include <SciPP/Core/templates/Quat.hpp>
 
+#include <SciPP/Core/templates/Allocator.hpp>
+#include <SciPP/Core/templates/ScratchArena.hpp>
+#include <SciPP/Core/templates/Execution.hpp>
+#include <SciPP/Core/templates/Simd.hpp>
+#include <SciPP/Core/templates/Gemm.hpp>
+#include <SciPP/Core/templates/Fft.hpp>
 #include <SciPP/Core/templates/TensorUtils.hpp>
+#include <SciPP/Core/templates/TensorExpr.hpp>
+#include <SciPP/Core/templates/TensorView.hpp>
 #include <SciPP/Core/templates/Tensor.hpp>
 #include <SciPP/Core/templates/Matrix.hpp>
 #include <SciPP/Core/templates/Vector.hpp>
+#include <SciPP/Core/templates/FixedRankTensor.hpp>
+#include <SciPP/Core/templates/StaticTensor.hpp>
+#include <SciPP/Core/templates/HaloTensor.hpp>
+#include <SciPP/Core/templates/Stencil.hpp>
+#include <SciPP/Core/templates/LU.hpp>
+#include <SciPP/Core/templates/Tridiagonal.hpp>
+#include <SciPP/Core/templates/BandedMatrix.hpp>
 
 #include <SciPP/Core/templates/Graph.hpp>
@@ -20,9 +20,24 @@
 #include <SciPP/Core/Rational.hpp>
 #include <SciPP/Core/Quat.hpp>
 
+#include <SciPP/Core/Allocator.hpp>
+#include <SciPP/Core/ScratchArena.hpp>
+#include <SciPP/Core/Execution.hpp>
+#include <SciPP/Core/Simd.hpp>
+#include <SciPP/Core/Gemm.hpp>
+#include <SciPP/Core/Fft.hpp>
 #include <SciPP/Core/TensorUtils.hpp>
+#include <SciPP/Core/TensorExpr.hpp>
+#include <SciPP/Core/TensorView.hpp>
 #include <SciPP/Core/Tensor.hpp>
 #include <SciPP/Core/Matrix.hpp>
 #include <SciPP/Core/Vector.hpp>
+#include <SciPP/Core/FixedRankTensor.hpp>
+#include <SciPP/Core/StaticTensor.hpp>
+#include <SciPP/Core/HaloTensor.hpp>
+#include <SciPP/Core/Stencil.hpp>
+#include <SciPP/Core/LU.hpp>
+#include <SciPP/Core/Tridiagonal.hpp>
+#include <SciPP/Core/BandedMatrix.hpp>
 
 #include <SciPP/Core/Graph.hpp>
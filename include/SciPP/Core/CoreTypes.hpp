@@ -9,22 +9,31 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <bit>
 #include <cassert>
 #include <cmath>
 #include <complex>
 #include <concepts>
+#include <condition_variable>
 #include <cstdint>
 #include <cstring>
+#include <exception>
 #include <forward_list>
 #include <functional>
 #include <initializer_list>
 #include <iterator>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <new>
 #include <numbers>
 #include <numeric>
+#include <span>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
@@ -68,6 +77,9 @@ namespace scp
 	template<typename TInteger> class Rational;
 
 
+	class TensorAllocator;
+	class ScratchArena;
+
 	struct TensorPosition;
 	class TensorShapeIterator;
 	struct TensorShape;
@@ -78,6 +90,19 @@ namespace scp
 	template<typename TValue> class Tensor;
 	template<typename TValue> class Matrix;
 	template<typename TValue> class Vector;
+	template<typename TValue, uint64_t Rank> class FixedRankTensor;
+	template<typename TValue, uint64_t... Sizes> class StaticTensor;
+	template<typename TValue> class TensorView;
+	template<typename TValue> class HaloTensor;
+	template<typename TValue> class LU;
+	template<typename TValue> class BandedMatrix;
+	template<typename TValue> class BandedLU;
+	template<typename TValue> class BandedCholesky;
+	template<typename T> concept CTensor = requires { typename T::ValueType; } && std::derived_from<T, Tensor<typename T::ValueType>>;
+	template<typename T> concept CTensorExpr = requires { typename T::IsTensorExpr; typename T::ValueType; };
+	template<typename T> concept CTensorView = CTensorExpr<T> && requires { typename T::IsTensorView; };
+	template<typename T> concept CStaticTensor = requires { typename T::IsStaticTensor; typename T::ValueType; };
+	template<typename T> concept CTensorOperand = CTensor<T> || CTensorExpr<T> || CStaticTensor<T>;
 
 
 	template <typename TNode, typename TEdge> class Graph;
@@ -0,0 +1,79 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//! \file
+//! \author Plgrin Marius
+//! \copyright The MIT License (MIT)
+//! \date 2019-2024
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <SciPP/Core/CoreTypes.hpp>
+
+namespace scp
+{
+	// Heavy routines split their work in tasks and hand them to the dispatcher, which is free to run them on any thread
+	// pool. It must call task(i) exactly once for each i in [0, taskCount) and only return once all of them are done.
+	// When no dispatcher is set, tasks run serially.
+
+	struct ExecutionPolicy
+	{
+		std::function<void(uint64_t taskCount, const std::function<void(uint64_t)>& task)> dispatcher = nullptr;
+		uint64_t concurrency = 1;		// Maximum number of tasks a routine is split into
+		uint64_t grainSize = 1 << 15;	// Minimum amount of work (roughly in scalar operations) per task
+	};
+
+	inline ExecutionPolicy exec;
+
+	// Threads created once and reused by every dispatch, so that their thread_local state, such as their scratch
+	// arena, lives from one routine to the next. The calling thread runs tasks too, so threadCount counts it. If a
+	// task throws, the other tasks still run and the first exception is rethrown by dispatch. Typical use:
+	//     scp::ThreadPool pool;
+	//     scp::exec.dispatcher = pool.getDispatcher();
+	//     scp::exec.concurrency = pool.getThreadCount();
+
+	class ThreadPool
+	{
+		public:
+
+			ThreadPool(uint64_t threadCount = std::max(std::thread::hardware_concurrency(), 1u));
+			ThreadPool(const ThreadPool& pool) = delete;
+			ThreadPool(ThreadPool&& pool) = delete;
+
+			ThreadPool& operator=(const ThreadPool& pool) = delete;
+			ThreadPool& operator=(ThreadPool&& pool) = delete;
+
+			void dispatch(uint64_t taskCount, const std::function<void(uint64_t)>& task);
+			std::function<void(uint64_t, const std::function<void(uint64_t)>&)> getDispatcher();
+
+			uint64_t getThreadCount() const;
+
+			~ThreadPool();
+
+		private:
+
+			void _work();
+			void _runTasks();
+
+			std::vector<std::thread> _threads;
+			std::mutex _dispatchMutex;
+			std::mutex _mutex;
+			std::condition_variable _wakeCondition;
+			std::condition_variable _doneCondition;
+
+			const std::function<void(uint64_t)>* _task;
+			uint64_t _taskCount;
+			std::atomic<uint64_t> _nextTask;
+			uint64_t _busyThreads;
+			uint64_t _generation;
+			bool _stopping;
+			std::exception_ptr _exception;
+	};
+
+	namespace _scp
+	{
+		template<typename TFunc>
+		constexpr void parallelFor(uint64_t count, uint64_t costPerItem, const TFunc& func);
+		template<typename TFunc>
+		constexpr void parallelFor(uint64_t count, const TFunc& func);
+	}
+}
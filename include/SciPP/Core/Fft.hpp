@@ -0,0 +1,184 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//! \file
+//! \author Plgrin Marius
+//! \copyright The MIT License (MIT)
+//! \date 2019-2024
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <SciPP/Core/CoreTypes.hpp>
+
+namespace scp
+{
+	namespace _scp
+	{
+		template<CComplex TValue> constexpr TValue fftRoot(uint64_t k, uint64_t n);
+
+		// Smallest size greater or equal to the given one with only 2, 3 and 5 as prime factors, for zero-padding
+		constexpr uint64_t fftFastSize(uint64_t size);
+
+		// Orders the cached plans by sizes, so that they can be looked up from a span of sizes without building a key
+		struct FftSizesLess
+		{
+			using is_transparent = void;
+
+			template<typename TSizesA, typename TSizesB>
+			constexpr bool operator()(const TSizesA& sizesA, const TSizesB& sizesB) const;
+		};
+
+		template<CComplex TValue>
+		constexpr void fftButterflies(uint64_t radix, const TValue* src, uint64_t srcStride, TValue* dst, uint64_t dstStride, const TValue* twiddles, const TValue* roots, uint64_t count, TValue* tmp);
+
+		// Self-sorting (Stockham) mixed radix transform of one line, ping-ponging between two buffers so that no
+		// permutation pass is needed. All tables are built once by the constructor, execute is const and works in a
+		// caller provided scratch buffer so that a single plan can be shared.
+		// Sizes with a prime factor above the threshold use Bluestein's algorithm instead: the transform is rewritten as
+		// a convolution with a chirp, computed with power of two transforms.
+
+		template<CComplex TValue>
+		class FftAxis
+		{
+			public:
+
+				constexpr FftAxis(uint64_t size);
+
+				constexpr void execute(TValue* data, uint64_t stride, bool inverse, TValue* scratch) const;
+
+				constexpr uint64_t getSize() const;
+				constexpr uint64_t getScratchSize() const;
+
+			private:
+
+				static constexpr uint64_t _bluesteinThreshold = 23;
+
+				constexpr void _executeBluestein(TValue* data, uint64_t stride, bool inverse, TValue* scratch) const;
+
+				uint64_t _size;
+				uint64_t _maxRadix;
+				std::vector<uint64_t> _radices;
+				std::vector<TValue> _twiddles;
+
+				std::vector<FftAxis<TValue>> _chirpAxis;
+				std::vector<TValue> _chirp;
+				std::vector<TValue> _chirpSpectrum;
+		};
+
+		// Transform of a real line of n values to its n/2+1 first coefficients, the others being their conjugates.
+		// Even sizes go through a complex transform of half the size.
+
+		template<CComplex TValue>
+		class FftRealAxis
+		{
+			public:
+
+				constexpr FftRealAxis(uint64_t size);
+
+				constexpr void forward(const typename TValue::value_type* input, TValue* output, TValue* scratch) const;
+				constexpr void backward(const TValue* input, typename TValue::value_type* output, TValue* scratch) const;
+
+				constexpr uint64_t getSize() const;
+				constexpr uint64_t getScratchSize() const;
+
+			private:
+
+				uint64_t _size;
+				FftAxis<TValue> _axis;
+				std::vector<TValue> _twiddles;
+		};
+
+		// Transforms all the lines of one axis of row-major data, in parallel. Lines of strided axes are copied by blocks
+		// of consecutive lines so that memory is read contiguously.
+
+		constexpr uint64_t fftBlockSize = 16;
+
+		template<CComplex TValue>
+		constexpr void fftLines(const FftAxis<TValue>& axis, TValue* data, uint64_t outerCount, uint64_t innerCount, bool inverse);
+	}
+
+	template<CComplex TValue>
+	class FftPlan
+	{
+		public:
+
+			static FftPlan<TValue>& getCached(const TensorShape& shape);
+			static void clearCache();
+
+			// Construction, copy and move operations
+
+			constexpr FftPlan(uint64_t order, const uint64_t* sizes);
+			constexpr FftPlan(const std::initializer_list<uint64_t>& sizes);
+			constexpr FftPlan(const FftPlan<TValue>& plan) = default;
+			constexpr FftPlan(FftPlan<TValue>&& plan) = default;
+
+			constexpr FftPlan<TValue>& operator=(const FftPlan<TValue>& plan) = default;
+			constexpr FftPlan<TValue>& operator=(FftPlan<TValue>&& plan) = default;
+
+			// Transforms, in place on row-major data of the plan's shape. The backward transform is normalized.
+
+			constexpr void forward(TValue* data);
+			constexpr void backward(TValue* data);
+
+			// Getters
+
+			constexpr uint64_t getOrder() const;
+			constexpr const uint64_t* getSizes() const;
+
+			// Destructor
+
+			constexpr ~FftPlan() = default;
+
+		private:
+
+			static std::map<std::vector<uint64_t>, FftPlan<TValue>, _scp::FftSizesLess>& _getCache();
+
+			constexpr void _execute(TValue* data, bool inverse);
+
+			std::vector<uint64_t> _sizes;
+			std::vector<_scp::FftAxis<TValue>> _axes;
+	};
+
+	template<std::floating_point TReal>
+	class RealFftPlan
+	{
+		public:
+
+			static RealFftPlan<TReal>& getCached(const TensorShape& shape);
+			static void clearCache();
+
+			// Construction, copy and move operations
+
+			constexpr RealFftPlan(uint64_t order, const uint64_t* sizes);
+			constexpr RealFftPlan(const std::initializer_list<uint64_t>& sizes);
+			constexpr RealFftPlan(const RealFftPlan<TReal>& plan) = default;
+			constexpr RealFftPlan(RealFftPlan<TReal>&& plan) = default;
+
+			constexpr RealFftPlan<TReal>& operator=(const RealFftPlan<TReal>& plan) = default;
+			constexpr RealFftPlan<TReal>& operator=(RealFftPlan<TReal>&& plan) = default;
+
+			// The spectrum has the plan's shape except for the last axis, which has size/2+1 elements. The backward
+			// transform is normalized and leaves its input untouched.
+
+			constexpr void forward(const TReal* input, std::complex<TReal>* output);
+			constexpr void backward(const std::complex<TReal>* input, TReal* output);
+
+			// Getters
+
+			constexpr uint64_t getOrder() const;
+			constexpr const uint64_t* getSizes() const;
+			constexpr uint64_t getSpectrumSize(uint64_t i) const;
+
+			// Destructor
+
+			constexpr ~RealFftPlan() = default;
+
+		private:
+
+			static std::map<std::vector<uint64_t>, RealFftPlan<TReal>, _scp::FftSizesLess>& _getCache();
+
+			std::vector<uint64_t> _sizes;
+			std::vector<_scp::FftAxis<std::complex<TReal>>> _axes;
+			_scp::FftRealAxis<std::complex<TReal>> _lastAxis;
+			std::vector<std::complex<TReal>> _spectrum;
+	};
+}
@@ -0,0 +1,77 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//! \file
+//! \author Plgrin Marius
+//! \copyright The MIT License (MIT)
+//! \date 2019-2024
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <SciPP/Core/CoreTypes.hpp>
+
+namespace scp
+{
+	// Tensor whose order is known at compile time, so that the index computations of its accessors are fully unrolled.
+	// They read the sizes of the shape, so that they remain right when the tensor is assigned to as a Tensor. It is a
+	// Tensor, so all the algorithms of Tensor remain available.
+
+	template<typename TValue, uint64_t Rank>
+	class FixedRankTensor : public Tensor<TValue>
+	{
+		static_assert(Rank != 0, "A tensor must have at least one axis.");
+
+		public:
+
+			static constexpr uint64_t rank = Rank;
+
+			// Construction, copy and move operations
+
+			constexpr FixedRankTensor(const uint64_t* sizes);
+			constexpr FixedRankTensor(const uint64_t* sizes, const TValue& value);
+			constexpr FixedRankTensor(const uint64_t* sizes, const TValue* values);
+			constexpr FixedRankTensor(const std::initializer_list<uint64_t>& sizes);
+			constexpr FixedRankTensor(const std::initializer_list<uint64_t>& sizes, const TValue& value);
+			constexpr FixedRankTensor(const std::initializer_list<uint64_t>& sizes, const TValue* values);
+			constexpr FixedRankTensor(const std::initializer_list<uint64_t>& sizes, const std::initializer_list<TValue>& values);
+			constexpr explicit FixedRankTensor(const Tensor<TValue>& tensor);
+			constexpr FixedRankTensor(const FixedRankTensor<TValue, Rank>& tensor) = default;
+			constexpr FixedRankTensor(FixedRankTensor<TValue, Rank>&& tensor) = default;
+			template<CTensorExpr TExpr> constexpr FixedRankTensor(const TExpr& expr);
+
+			constexpr FixedRankTensor<TValue, Rank>& operator=(const FixedRankTensor<TValue, Rank>& tensor) = default;
+			constexpr FixedRankTensor<TValue, Rank>& operator=(FixedRankTensor<TValue, Rank>&& tensor) = default;
+			constexpr FixedRankTensor<TValue, Rank>& operator=(const Tensor<TValue>& tensor);
+			template<CTensorExpr TExpr> constexpr FixedRankTensor<TValue, Rank>& operator=(const TExpr& expr);
+
+			// Computation-free getters and setters, unrolled over the rank
+
+			using Tensor<TValue>::operator[];
+			using Tensor<TValue>::get;
+			using Tensor<TValue>::set;
+
+			constexpr TValue& operator[](const std::initializer_list<uint64_t>& indices);
+			constexpr const TValue& operator[](const std::initializer_list<uint64_t>& indices) const;
+
+			constexpr const TValue& get(const uint64_t* indices) const;
+			constexpr const TValue& get(const std::initializer_list<uint64_t>& indices) const;
+			constexpr TValue& get(const uint64_t* indices);
+			constexpr TValue& get(const std::initializer_list<uint64_t>& indices);
+			constexpr void set(const uint64_t* indices, const TValue& value);
+			constexpr void set(const std::initializer_list<uint64_t>& indices, const TValue& value);
+
+			constexpr uint64_t getIndex(const uint64_t* indices) const;
+			constexpr void getIndices(uint64_t index, uint64_t* indices) const;
+			constexpr std::array<uint64_t, Rank> getStrides() const;
+
+			// Destructor
+
+			constexpr ~FixedRankTensor() = default;
+
+		private:
+
+			using Tensor<TValue>::_shape;
+			using Tensor<TValue>::_length;
+			using Tensor<TValue>::_values;
+			using Tensor<TValue>::_detachValues;
+	};
+}
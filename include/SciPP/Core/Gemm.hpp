@@ -0,0 +1,50 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//! \file
+//! \author Plgrin Marius
+//! \copyright The MIT License (MIT)
+//! \date 2019-2024
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <SciPP/Core/CoreTypes.hpp>
+
+namespace scp
+{
+	namespace _scp
+	{
+		// Adds to c the product of a and b, all stored row-major with the given distance between consecutive rows: a has
+		// m rows and k columns, b has k rows and n columns, and c has m rows and n columns.
+		// For float and double, large products are computed the BLIS way: b is packed by panels of kc rows and nc
+		// columns kept in L3, a by blocks of mc rows and kc columns kept in L2, and a register tile kernel goes through
+		// them, one slice of the b panel staying in L1. Other types, small products and products by a vector go through
+		// plain loops in an order that reads all matrices contiguously.
+		// The rows of c, or its columns when there are too few rows, are split between the tasks of exec. Each task packs
+		// its own blocks of a in its thread's scratch arena, so that they are first touched by the thread reading them.
+
+		template<typename TValue>
+		constexpr void gemm(uint64_t m, uint64_t n, uint64_t k, const TValue* a, uint64_t lda, const TValue* b, uint64_t ldb, TValue* c, uint64_t ldc);
+
+		template<typename TValue>
+		constexpr void gemmUnpacked(uint64_t m, uint64_t n, uint64_t k, const TValue* a, uint64_t lda, const TValue* b, uint64_t ldb, TValue* c, uint64_t ldc);
+
+		// Copies a block of rows x depth values of a into panels of kernel.rows rows, stored column by column, and a
+		// block of depth x cols values of b into panels of kernel.cols columns, stored row by row. Missing rows and
+		// columns of the last panel are zeroed.
+
+		template<CSimdReal TValue>
+		void gemmPackA(uint64_t rows, uint64_t depth, const TValue* a, uint64_t lda, uint64_t panelRows, TValue* packed);
+
+		template<CSimdReal TValue>
+		void gemmPackB(uint64_t depth, uint64_t cols, const TValue* b, uint64_t ldb, uint64_t panelCols, TValue* packed);
+
+		// Runs the kernel over a packed block of a and a packed panel of b, tile is a scratch of kernel.rows x kernel.cols
+		// values for the partial tiles on the borders of c
+
+		template<CSimdReal TValue>
+		void gemmBlock(uint64_t rows, uint64_t cols, uint64_t depth, const TValue* packedA, const TValue* packedB, TValue* c, uint64_t ldc, const SimdGemmKernel<TValue>& kernel, TValue* tile);
+
+		template<CSimdReal TValue>
+		void gemmPacked(uint64_t m, uint64_t n, uint64_t k, const TValue* a, uint64_t lda, const TValue* b, uint64_t ldb, TValue* c, uint64_t ldc, const SimdGemmKernel<TValue>& kernel);
+	}
+}
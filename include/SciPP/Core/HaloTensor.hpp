@@ -0,0 +1,89 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//! \file
+//! \author Plgrin Marius
+//! \copyright The MIT License (MIT)
+//! \date 2019-2024
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <SciPP/Core/CoreTypes.hpp>
+
+namespace scp
+{
+	// Tensor stored with ghost cells around it: each axis i is padded by halos[i] elements on both sides. Once the
+	// ghost cells are filled with fillHalo, any element up to halos[i] away from the interior along each axis can be
+	// read without bound checks, using signed indices relative to the first interior element.
+
+	template<typename TValue>
+	class HaloTensor
+	{
+		public:
+
+			using ValueType = TValue;
+
+			// Construction, copy and move operations
+
+			constexpr HaloTensor(uint64_t order, const uint64_t* sizes, const uint64_t* halos);
+			constexpr HaloTensor(uint64_t order, const uint64_t* sizes, const uint64_t* halos, const TValue& value);
+			constexpr HaloTensor(const std::initializer_list<uint64_t>& sizes, const std::initializer_list<uint64_t>& halos);
+			constexpr HaloTensor(const std::initializer_list<uint64_t>& sizes, const std::initializer_list<uint64_t>& halos, const TValue& value);
+			constexpr HaloTensor(const Tensor<TValue>& tensor, const uint64_t* halos);
+			constexpr HaloTensor(const Tensor<TValue>& tensor, const std::initializer_list<uint64_t>& halos);
+			constexpr HaloTensor(const HaloTensor<TValue>& tensor) = default;
+			constexpr HaloTensor(HaloTensor<TValue>&& tensor) = default;
+
+			constexpr HaloTensor<TValue>& operator=(const HaloTensor<TValue>& tensor) = default;
+			constexpr HaloTensor<TValue>& operator=(HaloTensor<TValue>&& tensor) = default;
+			template<CTensorOperand TOperand> constexpr HaloTensor<TValue>& operator=(const TOperand& operand);
+
+			// Fills the ghost cells from the interior, axis after axis so that corners are consistent
+
+			template<BorderBehaviour BBehaviour> constexpr void fillHalo();
+
+			// Views on the interior and on the whole padded storage
+
+			constexpr TensorView<TValue> getInterior();
+			constexpr TensorView<const TValue> getInterior() const;
+			constexpr Tensor<TValue>& getPadded();
+			constexpr const Tensor<TValue>& getPadded() const;
+
+			// Computation-free getters and setters, indices may go up to the halo width out of the interior
+
+			constexpr TValue& operator[](const std::initializer_list<int64_t>& indices);
+			constexpr const TValue& operator[](const std::initializer_list<int64_t>& indices) const;
+
+			constexpr TValue& get(const int64_t* indices);
+			constexpr const TValue& get(const int64_t* indices) const;
+			constexpr TValue& get(const std::initializer_list<int64_t>& indices);
+			constexpr const TValue& get(const std::initializer_list<int64_t>& indices) const;
+
+			constexpr uint64_t getOrder() const;
+			constexpr const uint64_t* getSizes() const;
+			constexpr uint64_t getSize(uint64_t i) const;
+			constexpr const uint64_t* getHalos() const;
+			constexpr uint64_t getHalo(uint64_t i) const;
+			constexpr const int64_t* getStrides() const;
+			constexpr int64_t getStride(uint64_t i) const;
+			constexpr uint64_t getElementCount() const;
+			constexpr TValue* getData();
+			constexpr const TValue* getData() const;
+
+			// Destructor
+
+			constexpr ~HaloTensor() = default;
+
+		private:
+
+			static constexpr std::vector<uint64_t> _getPaddedSizes(uint64_t order, const uint64_t* sizes, const uint64_t* halos);
+
+			constexpr void _computeStrides();
+			constexpr int64_t _getOffset(const int64_t* indices) const;
+
+			Tensor<TValue> _tensor;
+			std::vector<uint64_t> _sizes;
+			std::vector<uint64_t> _halos;
+			std::vector<int64_t> _strides;
+			int64_t _origin;
+	};
+}
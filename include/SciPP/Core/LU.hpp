@@ -0,0 +1,91 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//! \file
+//! \author Plgrin Marius
+//! \copyright The MIT License (MIT)
+//! \date 2019-2024
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <SciPP/Core/CoreTypes.hpp>
+
+namespace scp
+{
+	namespace _scp
+	{
+		template<typename TValue>
+		concept HasStdAbs = requires (TValue x) { std::abs(x) < std::abs(x); };
+
+		struct LUStatus
+		{
+			bool singular;
+			bool oddPermutation;
+		};
+
+		// Kernels of LU on a row-major matrix of the given size, so that Matrix can also run them on scratch memory.
+		// luSolve solves in place count right-hand sides stored as the columns of x.
+
+		template<typename TValue>
+		constexpr LUStatus luFactorize(uint64_t size, TValue* values, uint64_t* pivots);
+
+		template<typename TValue>
+		constexpr void luSolve(uint64_t size, const TValue* factors, const uint64_t* pivots, TValue* x, uint64_t count);
+
+		template<typename TValue>
+		constexpr TValue luDeterminant(uint64_t size, const TValue* factors, const LUStatus& status);
+
+		template<typename TValue>
+		constexpr void luFactorizePanel(uint64_t size, TValue* values, uint64_t* pivots, uint64_t begin, uint64_t end, LUStatus& status);
+
+		// c -= a.b, through a negated copy of a
+		template<typename TValue>
+		constexpr void luSubtractProduct(uint64_t m, uint64_t n, uint64_t k, const TValue* a, uint64_t lda, const TValue* b, uint64_t ldb, TValue* c, uint64_t ldc);
+
+		inline constexpr uint64_t luBlockSize = 64;
+	}
+
+	// LU factorization with partial pivoting: P.A = L.U, with P a permutation, L unit lower triangular and U upper
+	// triangular, L and U sharing a single matrix. The factorization goes by panels of columns, the rest of the matrix
+	// being updated with one matrix product per panel, and is then reused by every solve.
+	// Pivots are chosen by largest magnitude when std::abs is available for TValue, as the first non-zero otherwise.
+	// A singular matrix is factorized all the same, but solving with it throws.
+
+	template<typename TValue>
+	class LU
+	{
+		public:
+
+			// Construction, copy and move operations
+
+			constexpr LU(const Matrix<TValue>& matrix);
+			constexpr LU(const LU<TValue>& lu) = default;
+			constexpr LU(LU<TValue>&& lu) = default;
+
+			constexpr LU<TValue>& operator=(const LU<TValue>& lu) = default;
+			constexpr LU<TValue>& operator=(LU<TValue>&& lu) = default;
+
+			// Solves A.x = b in place, each column of B being a right-hand side
+
+			constexpr void solve(Vector<TValue>& b) const;
+			constexpr void solve(Matrix<TValue>& B) const;
+
+			constexpr TValue determinant() const;
+			constexpr bool isSingular() const;
+
+			// Row i of A was swapped with row getPivots()[i] >= i before the elimination of column i
+
+			constexpr const Matrix<TValue>& getFactors() const;
+			constexpr const uint64_t* getPivots() const;
+			constexpr uint64_t getSize() const;
+
+			// Destructor
+
+			constexpr ~LU() = default;
+
+		private:
+
+			Matrix<TValue> _factors;
+			std::vector<uint64_t> _pivots;
+			_scp::LUStatus _status;
+	};
+}
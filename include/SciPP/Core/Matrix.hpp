@@ -24,16 +24,18 @@ namespace scp
 			constexpr Matrix(uint64_t row, uint64_t col, const std::initializer_list<TValue>& values);
 			constexpr Matrix(const Matrix<TValue>& matrix);
 			constexpr Matrix(Matrix<TValue>&& matrix);
+			template<CTensorExpr TExpr> constexpr Matrix(const TExpr& expr);
 
 			constexpr Matrix<TValue>& operator=(const Matrix<TValue>& matrix) = default;
 			constexpr Matrix<TValue>& operator=(Matrix<TValue>&& matrix) = default;
+			template<CTensorExpr TExpr> constexpr Matrix<TValue>& operator=(const TExpr& expr);
 
 			constexpr void matrixProduct(const Tensor<TValue>& matrixA, const Tensor<TValue>& matrixB);
 			
 			constexpr void transpose();
 			
 			constexpr void inverse();
-			// TODO: cholesky, LDL, LU, QR, Polar, etc....
+			// TODO: cholesky, LDL, QR, Polar, etc....
 
 			constexpr TValue determinant() const;
 
@@ -50,50 +52,10 @@ namespace scp
 			using Tensor<TValue>::_length;
 			using Tensor<TValue>::_values;
 			using Tensor<TValue>::_owner;
+
+			using Tensor<TValue>::_detachValues;
 	};
 
-	template<typename TValue>
-	constexpr Matrix<TValue> operator+(const Matrix<TValue>& matrixA, const Matrix<TValue>& matrixB);
-	template<typename TValue>
-	constexpr Matrix<TValue>&& operator+(Matrix<TValue>&& matrixA, const Matrix<TValue>& matrixB);
-	template<typename TValue>
-	constexpr Matrix<TValue>&& operator+(const Matrix<TValue>& matrixA, Matrix<TValue>&& matrixB);
-	template<typename TValue>
-	constexpr Matrix<TValue>&& operator+(Matrix<TValue>&& matrixA, Matrix<TValue>&& matrixB);
-	
-	template<typename TValue>
-	constexpr Matrix<TValue> operator-(const Matrix<TValue>& matrixA, const Matrix<TValue>& matrixB);
-	template<typename TValue>
-	constexpr Matrix<TValue>&& operator-(Matrix<TValue>&& matrixA, const Matrix<TValue>& matrixB);
-	template<typename TValue>
-	constexpr Matrix<TValue>&& operator-(const Matrix<TValue>& matrixA, Matrix<TValue>&& matrixB);
-	template<typename TValue>
-	constexpr Matrix<TValue>&& operator-(Matrix<TValue>&& matrixA, Matrix<TValue>&& matrixB);
-	
-	template<typename TValue, typename TScalar>
-	constexpr Matrix<TValue> operator*(const Matrix<TValue>& matrix, const TScalar& scalar);
-	template<typename TValue, typename TScalar>
-	constexpr Matrix<TValue>&& operator*(Matrix<TValue>&& matrix, const TScalar& scalar);
-	template<typename TValue, typename TScalar>
-	constexpr Matrix<TValue> operator*(const TScalar& scalar, const Matrix<TValue>& matrix);
-	template<typename TValue, typename TScalar>
-	constexpr Matrix<TValue>&& operator*(const TScalar& scalar, Matrix<TValue>&& matrix);
-	
-	template<typename TValue, typename TScalar>
-	constexpr Matrix<TValue> operator/(const Matrix<TValue>& matrix, const TScalar& scalar);
-	template<typename TValue, typename TScalar>
-	constexpr Matrix<TValue>&& operator/(Matrix<TValue>&& matrix, const TScalar& scalar);
-	
-	template<typename TValue>
-	constexpr Matrix<TValue> operator-(const Matrix<TValue>& matrix);
-	template<typename TValue>
-	constexpr Matrix<TValue>&& operator-(Matrix<TValue>&& matrix);
-	
-	template<typename TValue>
-	constexpr Matrix<TValue> operator+(const Matrix<TValue>& matrix);
-	template<typename TValue>
-	constexpr Matrix<TValue>&& operator+(Matrix<TValue>&& matrix);
-	
 	template<typename TValue>
 	Matrix<TValue> operator*(const Matrix<TValue>& matrixA, const Matrix<TValue>& matrixB);
 }
@@ -0,0 +1,110 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//! \file
+//! \author Plgrin Marius
+//! \copyright The MIT License (MIT)
+//! \date 2019-2024
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <SciPP/Core/CoreTypes.hpp>
+
+namespace scp
+{
+	// Bump allocator for the temporaries of algorithms. Memory is released by rewinding to a marker, blocks being kept
+	// for later use, so that once warmed up, repeated calls to the same algorithms do not touch the heap anymore.
+	// An arena must only be used by one thread at a time.
+
+	class ScratchArena
+	{
+		public:
+
+			struct Marker
+			{
+				uint64_t block;
+				uint64_t offset;
+			};
+
+			// Construction, copy and move operations
+
+			ScratchArena(uint64_t blockSize = 1 << 20);
+			ScratchArena(const ScratchArena& arena) = delete;
+			ScratchArena(ScratchArena&& arena) = delete;
+
+			ScratchArena& operator=(const ScratchArena& arena) = delete;
+			ScratchArena& operator=(ScratchArena&& arena) = delete;
+
+			// Allocation, everything allocated after a marker is released at once by rewinding to it
+
+			void* allocate(uint64_t size, uint64_t alignment);
+
+			Marker getMarker() const;
+			void rewind(const Marker& marker);
+			void reset();
+
+			// Frees the blocks, the arena must be empty
+			void release();
+
+			uint64_t getCapacity() const;
+
+			// Destructor
+
+			~ScratchArena();
+
+		private:
+
+			struct Block
+			{
+				void* memory;
+				uint64_t size;
+			};
+
+			static constexpr uint64_t _blockAlignment = 64;
+
+			uint64_t _blockSize;
+			std::vector<Block> _blocks;
+			uint64_t _block;
+			uint64_t _offset;
+	};
+
+	// Each thread draws its temporaries from the arena pointed by scratchArena, which is its own default arena unless
+	// set otherwise.
+
+	inline thread_local ScratchArena defaultScratchArena;
+	inline thread_local ScratchArena* scratchArena = &defaultScratchArena;
+
+	namespace _scp
+	{
+		// Array of temporaries taken from the current thread's arena and given back on destruction, so buffers must be
+		// destroyed in the reverse order of their construction. During constant evaluation, it is allocated normally.
+
+		template<typename T>
+		class ScratchBuffer
+		{
+			public:
+
+				constexpr ScratchBuffer(uint64_t size);
+				constexpr ScratchBuffer(const ScratchBuffer<T>& buffer) = delete;
+				constexpr ScratchBuffer(ScratchBuffer<T>&& buffer) = delete;
+
+				constexpr ScratchBuffer<T>& operator=(const ScratchBuffer<T>& buffer) = delete;
+				constexpr ScratchBuffer<T>& operator=(ScratchBuffer<T>&& buffer) = delete;
+
+				constexpr T& operator[](uint64_t i);
+				constexpr const T& operator[](uint64_t i) const;
+
+				constexpr uint64_t getSize() const;
+				constexpr T* getData();
+				constexpr const T* getData() const;
+
+				constexpr ~ScratchBuffer();
+
+			private:
+
+				ScratchArena* _arena;
+				ScratchArena::Marker _marker;
+				T* _data;
+				uint64_t _size;
+		};
+	}
+}
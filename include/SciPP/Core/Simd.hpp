@@ -0,0 +1,86 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//! \file
+//! \author Plgrin Marius
+//! \copyright The MIT License (MIT)
+//! \date 2019-2024
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <SciPP/Core/CoreTypes.hpp>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+	#define SCP_SIMD_X86
+
+	#include <immintrin.h>
+
+	#if defined(_MSC_VER) && !defined(__clang__)
+		#include <intrin.h>
+		#define SCP_SIMD_TARGET(isa)
+	#else
+		#define SCP_SIMD_TARGET(isa) __attribute__((target(isa)))
+	#endif
+
+	#if defined(__clang__)
+		#define SCP_SIMD_UNROLL _Pragma("unroll")
+	#elif defined(__GNUC__)
+		#define SCP_SIMD_UNROLL _Pragma("GCC unroll 16")
+	#else
+		#define SCP_SIMD_UNROLL
+	#endif
+#endif
+
+namespace scp
+{
+	namespace _scp
+	{
+		enum class SimdLevel
+		{
+			None,
+			Sse2,
+			Avx2,
+			Avx512
+		};
+
+		inline SimdLevel getSimdLevel();
+		inline bool hasSimdFma();
+
+		template<typename T> concept CSimdReal = std::same_as<T, float> || std::same_as<T, double>;
+		template<typename T> concept CSimdValue = CSimdReal<T> || (CComplex<T> && CSimdReal<typename T::value_type>);
+
+		template<CSimdValue TValue> struct SimdRealType { using Type = TValue; };
+		template<CSimdValue TValue> requires CComplex<TValue> struct SimdRealType<TValue> { using Type = typename TValue::value_type; };
+
+		// Elementwise kernels on contiguous arrays, dispatched at runtime on the best instruction set available
+
+		template<CSimdValue TValue> void simdAdd(TValue* dst, const TValue* src, uint64_t count);
+		template<CSimdValue TValue> void simdSub(TValue* dst, const TValue* src, uint64_t count);
+		template<CSimdValue TValue> void simdMultiply(TValue* dst, const TValue* src, uint64_t count);
+		template<CSimdValue TValue> void simdScale(TValue* dst, const typename SimdRealType<TValue>::Type& scalar, uint64_t count);
+		template<CSimdValue TValue> requires CComplex<TValue> void simdScale(TValue* dst, const TValue& scalar, uint64_t count);
+		template<CSimdValue TValue> void simdDivide(TValue* dst, const typename SimdRealType<TValue>::Type& scalar, uint64_t count);
+		template<CSimdValue TValue> void simdNegate(TValue* dst, uint64_t count);
+		template<CSimdValue TValue> void simdMultiplyAdd(TValue* dst, const TValue* src, const typename SimdRealType<TValue>::Type& scalar, uint64_t count);
+		template<CSimdReal TValue> TValue simdDot(const TValue* x, const TValue* y, uint64_t count);
+
+		// Register tile of the packed matrix product, see Gemm.hpp. func adds to the rows x cols tile of c, of row stride
+		// ldc, the product of a panel of a stored column by column (rows values per column) and of a panel of b stored
+		// row by row (cols values per row), both of the given depth. func is null when no kernel fits the processor.
+
+		template<CSimdReal TValue>
+		struct SimdGemmKernel
+		{
+			uint64_t rows;
+			uint64_t cols;
+			void (*func)(uint64_t depth, const TValue* a, const TValue* b, TValue* c, uint64_t ldc);
+		};
+
+		template<CSimdReal TValue> SimdGemmKernel<TValue> getSimdGemmKernel();
+
+		// Stockham FFT butterflies, see Fft.hpp. They return how many elements they processed, possibly none.
+
+		template<CSimdValue TValue> requires CComplex<TValue> uint64_t simdFftRadix2(const TValue* src, uint64_t srcStride, TValue* dst, uint64_t dstStride, const TValue* twiddles, uint64_t count);
+		template<CSimdValue TValue> requires CComplex<TValue> uint64_t simdFftRadix4(const TValue* src, uint64_t srcStride, TValue* dst, uint64_t dstStride, const TValue* twiddles, uint64_t count);
+		template<CSimdValue TValue> requires CComplex<TValue> uint64_t simdFftRadix8(const TValue* src, uint64_t srcStride, TValue* dst, uint64_t dstStride, const TValue* twiddles, uint64_t count);
+	}
+}
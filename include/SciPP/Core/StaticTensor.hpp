@@ -0,0 +1,135 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//! \file
+//! \author Plgrin Marius
+//! \copyright The MIT License (MIT)
+//! \date 2019-2024
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <SciPP/Core/CoreTypes.hpp>
+
+namespace scp
+{
+	namespace _scp
+	{
+		// Tensor using the shape and values of another object, without allocating nor owning anything. It can neither
+		// be copied nor moved, so that a Tensor built from it always copies the values.
+
+		template<typename TValue>
+		class BorrowedTensor : public Tensor<TValue>
+		{
+			public:
+
+				constexpr BorrowedTensor(const TensorShape& shape, const TValue* values);
+				constexpr BorrowedTensor(const BorrowedTensor<TValue>& tensor) = delete;
+				constexpr BorrowedTensor(BorrowedTensor<TValue>&& tensor) = delete;
+
+				constexpr BorrowedTensor<TValue>& operator=(const BorrowedTensor<TValue>& tensor) = delete;
+				constexpr BorrowedTensor<TValue>& operator=(BorrowedTensor<TValue>&& tensor) = delete;
+
+				constexpr ~BorrowedTensor();
+
+			private:
+
+				using Tensor<TValue>::_shape;
+				using Tensor<TValue>::_length;
+				using Tensor<TValue>::_values;
+				using Tensor<TValue>::_owner;
+		};
+	}
+
+	// Small tensor whose shape is known at compile time, stored inline without any allocation nor virtual destructor.
+	// It can be used in tensor expressions, and converts implicitly to a const Tensor referencing its values, so that
+	// it can be passed as a convolution kernel or a contraction operand without copy.
+
+	template<typename TValue, uint64_t... Sizes>
+	class StaticTensor
+	{
+		static_assert(sizeof...(Sizes) != 0, "A tensor must have at least one axis.");
+		static_assert(((Sizes != 0) && ...), "A tensor cannot have an empty axis.");
+
+		public:
+
+			using IsStaticTensor = bool;
+			using ValueType = TValue;
+
+			static constexpr uint64_t order = sizeof...(Sizes);
+			static constexpr uint64_t elementCount = (Sizes * ...);
+
+			// Construction, copy and move operations
+
+			constexpr StaticTensor();
+			constexpr StaticTensor(const TValue& value);
+			constexpr StaticTensor(const TValue* values);
+			constexpr StaticTensor(const std::initializer_list<TValue>& values);
+			constexpr explicit StaticTensor(const Tensor<TValue>& tensor);
+			template<CTensorExpr TExpr> constexpr StaticTensor(const TExpr& expr);
+			constexpr StaticTensor(const StaticTensor<TValue, Sizes...>& tensor) = default;
+			constexpr StaticTensor(StaticTensor<TValue, Sizes...>&& tensor) = default;
+
+			constexpr StaticTensor<TValue, Sizes...>& operator=(const StaticTensor<TValue, Sizes...>& tensor) = default;
+			constexpr StaticTensor<TValue, Sizes...>& operator=(StaticTensor<TValue, Sizes...>&& tensor) = default;
+			constexpr StaticTensor<TValue, Sizes...>& operator=(const Tensor<TValue>& tensor);
+			template<CTensorExpr TExpr> constexpr StaticTensor<TValue, Sizes...>& operator=(const TExpr& expr);
+
+			constexpr operator const _scp::BorrowedTensor<TValue>() const;
+
+			// Other standard operators
+
+			constexpr bool operator==(const StaticTensor<TValue, Sizes...>& tensor) const = default;
+
+			constexpr TValue* begin();
+			constexpr TValue* end();
+			constexpr const TValue* begin() const;
+			constexpr const TValue* end() const;
+
+			// Computation-free getters and setters
+
+			constexpr TValue& operator[](uint64_t index);
+			constexpr const TValue& operator[](uint64_t index) const;
+			constexpr TValue& operator[](const std::initializer_list<uint64_t>& indices);
+			constexpr const TValue& operator[](const std::initializer_list<uint64_t>& indices) const;
+
+			constexpr const TValue& get(uint64_t index) const;
+			constexpr const TValue& get(const uint64_t* indices) const;
+			constexpr TValue& get(uint64_t index);
+			constexpr TValue& get(const uint64_t* indices);
+			constexpr void set(uint64_t index, const TValue& value);
+			constexpr void set(const uint64_t* indices, const TValue& value);
+
+			static constexpr uint64_t getIndex(const uint64_t* indices);
+			static constexpr void getIndices(uint64_t index, uint64_t* indices);
+
+			static constexpr const TensorShape& getShape();
+			static constexpr uint64_t getOrder();
+			static constexpr const uint64_t* getSizes();
+			static constexpr uint64_t getSize(uint64_t i);
+			static constexpr uint64_t getElementCount();
+			constexpr TValue* getData();
+			constexpr const TValue* getData() const;
+
+			// Destructor
+
+			constexpr ~StaticTensor() = default;
+
+		private:
+
+			static constexpr std::array<uint64_t, order> _sizes = { Sizes... };
+			static constexpr std::array<uint64_t, order> _strides = []()
+			{
+				std::array<uint64_t, order> strides;
+				uint64_t stride = 1;
+				for (uint64_t i = order; i-- > 0;)
+				{
+					strides[i] = stride;
+					stride *= _sizes[i];
+				}
+
+				return strides;
+			}();
+			static constexpr TensorShape _shape = { order, const_cast<uint64_t*>(_sizes.data()) };
+
+			std::array<TValue, elementCount> _values;
+	};
+}
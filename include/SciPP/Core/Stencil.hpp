@@ -0,0 +1,34 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//! \file
+//! \author Plgrin Marius
+//! \copyright The MIT License (MIT)
+//! \date 2019-2024
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <SciPP/Core/CoreTypes.hpp>
+
+namespace scp
+{
+	// Position of a neighbour relative to the computed element, one signed index per axis
+
+	template<int64_t... Indices>
+	struct StencilOffset
+	{
+		using IsStencilOffset = bool;
+
+		static constexpr uint64_t order = sizeof...(Indices);
+		static constexpr std::array<int64_t, sizeof...(Indices)> indices = { Indices... };
+	};
+
+	template<typename T> concept CStencilOffset = requires { typename T::IsStencilOffset; T::order; T::indices; };
+
+	// output[x] = func(inputs[0][x + TOffsets]..., inputs[1][x + TOffsets]..., ...), the values of each input at each
+	// offset being passed in order. Neighbours out of the tensor follow BBehaviour. The offsets are turned into linear
+	// offsets once, so that elements whose neighbours are all inside the tensor are computed without any index
+	// computation nor bound check. All tensors must have the same shape and output must not be one of the inputs.
+
+	template<BorderBehaviour BBehaviour, CStencilOffset... TOffsets, typename TValue, typename TFunc, typename... TInputValues>
+	constexpr void stencil(Tensor<TValue>& output, const TFunc& func, const Tensor<TInputValues>&... inputs);
+}
@@ -16,10 +16,13 @@ namespace scp
 	{
 		public:
 
+			using ValueType = TValue;
+
 			// Construction, copy and move operations
 
 			static constexpr Tensor<TValue>* createAroundMemory(uint64_t order, const uint64_t* sizes, TValue* memory);
 			static constexpr Tensor<TValue>* createAroundMemory(const std::initializer_list<uint64_t>& sizes, TValue* memory);
+			static constexpr Tensor<TValue>* createAroundMemory(const TensorView<TValue>& view);
 
 			constexpr Tensor(uint64_t order, const uint64_t* sizes);
 			constexpr Tensor(uint64_t order, const uint64_t* sizes, const TValue& value);
@@ -31,14 +34,18 @@ namespace scp
 			constexpr Tensor(const std::initializer_list<uint64_t>& sizes, const std::initializer_list<TValue>& values);
 			constexpr Tensor(const Tensor<TValue>& tensor);
 			constexpr Tensor(Tensor<TValue>&& tensor);
+			template<CTensorExpr TExpr> constexpr Tensor(const TExpr& expr);
 
 			constexpr Tensor<TValue>& operator=(const Tensor<TValue>& tensor);
 			constexpr Tensor<TValue>& operator=(Tensor<TValue>&& tensor);
+			template<CTensorExpr TExpr> constexpr Tensor<TValue>& operator=(const TExpr& expr);
 
 			// Operators that modifies the tensor globally
 
 			constexpr Tensor<TValue>& operator+=(const Tensor<TValue>& tensor);
 			constexpr Tensor<TValue>& operator-=(const Tensor<TValue>& tensor);
+			template<CTensorExpr TExpr> constexpr Tensor<TValue>& operator+=(const TExpr& expr);
+			template<CTensorExpr TExpr> constexpr Tensor<TValue>& operator-=(const TExpr& expr);
 			template<typename TScalar> constexpr Tensor<TValue>& operator*=(const TScalar& scalar);
 			template<typename TScalar> constexpr Tensor<TValue>& operator/=(const TScalar& scalar);
 			constexpr Tensor<TValue>& negate();
@@ -47,8 +54,12 @@ namespace scp
 			constexpr void hadamardProduct(const Tensor<TValue>& tensor);
 			constexpr void fft();
 			constexpr void ifft();
+			template<CComplex TComplex> constexpr void rfft(Tensor<TComplex>& spectrum) const;
+			template<std::floating_point TReal> constexpr void irfft(Tensor<TReal>& output) const;
 
 			template<BorderBehaviour BBehaviour> constexpr void convolution(const Tensor<TValue>& kernel);
+			template<BorderBehaviour BBehaviour> constexpr void separableConvolution(const Vector<TValue>* kernels);
+			template<BorderBehaviour BBehaviour> constexpr void separableConvolution(const std::initializer_list<Vector<TValue>>& kernels);
 
 			// TODO: template<typename TScalar, InterpolationMethod MagMethod, CollapseMethod MinMethod> constexpr void resize(const Tensor<TValue>& tensor);
 			template<typename TScalar, InterpolationMethod IMethod> constexpr void resize(const Tensor<TValue>& tensor);
@@ -106,7 +117,16 @@ namespace scp
 
 			constexpr Tensor();
 
-			constexpr void _ndCooleyTukey(TValue* beg, uint64_t order, const TValue* const* bases);
+			template<BorderBehaviour BBehaviour> constexpr void _fftConvolution(const Tensor<TValue>& kernel);
+			template<BorderBehaviour BBehaviour> constexpr void _separableConvolution(const TValue* const* kernels, const uint64_t* kernelSizes);
+			constexpr bool _separateKernel(TValue* const* factors) const;
+
+			constexpr void _allocateValues();
+			constexpr void _deallocateValues();
+			constexpr bool _isShared() const;
+			constexpr void _detachValues();
+			constexpr void _copySharedValues();
+			constexpr void _leakValues();
 
 			static constexpr TValue _zero = 0;
 			static constexpr TValue _one = 1;
@@ -116,50 +136,10 @@ namespace scp
 			TValue* _values;
 
 			bool _owner;
+			TensorAllocator* _allocator;
+			std::atomic<uint64_t>* _references;
 
 		friend class Matrix<TValue>;
 		friend class Vector<TValue>;
 	};
-
-	template<typename TValue>
-	constexpr Tensor<TValue> operator+(const Tensor<TValue>& tensorA, const Tensor<TValue>& tensorB);
-	template<typename TValue>
-	constexpr Tensor<TValue>&& operator+(Tensor<TValue>&& tensorA, const Tensor<TValue>& tensorB);
-	template<typename TValue>
-	constexpr Tensor<TValue>&& operator+(const Tensor<TValue>& tensorA, Tensor<TValue>&& tensorB);
-	template<typename TValue>
-	constexpr Tensor<TValue>&& operator+(Tensor<TValue>&& tensorA, Tensor<TValue>&& tensorB);
-	
-	template<typename TValue>
-	constexpr Tensor<TValue> operator-(const Tensor<TValue>& tensorA, const Tensor<TValue>& tensorB);
-	template<typename TValue>
-	constexpr Tensor<TValue>&& operator-(Tensor<TValue>&& tensorA, const Tensor<TValue>& tensorB);
-	template<typename TValue>
-	constexpr Tensor<TValue>&& operator-(const Tensor<TValue>& tensorA, Tensor<TValue>&& tensorB);
-	template<typename TValue>
-	constexpr Tensor<TValue>&& operator-(Tensor<TValue>&& tensorA, Tensor<TValue>&& tensorB);
-	
-	template<typename TValue, typename TScalar>
-	constexpr Tensor<TValue> operator*(const Tensor<TValue>& tensor, const TScalar& scalar);
-	template<typename TValue, typename TScalar>
-	constexpr Tensor<TValue>&& operator*(Tensor<TValue>&& tensor, const TScalar& scalar);
-	template<typename TValue, typename TScalar>
-	constexpr Tensor<TValue> operator*(const TScalar& scalar, const Tensor<TValue>& tensor);
-	template<typename TValue, typename TScalar>
-	constexpr Tensor<TValue>&& operator*(const TScalar& scalar, Tensor<TValue>&& tensor);
-	
-	template<typename TValue, typename TScalar>
-	constexpr Tensor<TValue> operator/(const Tensor<TValue>& tensor, const TScalar& scalar);
-	template<typename TValue, typename TScalar>
-	constexpr Tensor<TValue>&& operator/(Tensor<TValue>&& tensor, const TScalar& scalar);
-	
-	template<typename TValue>
-	constexpr Tensor<TValue> operator-(const Tensor<TValue>& tensor);
-	template<typename TValue>
-	constexpr Tensor<TValue>&& operator-(Tensor<TValue>&& tensor);
-	
-	template<typename TValue>
-	constexpr Tensor<TValue> operator+(const Tensor<TValue>& tensor);
-	template<typename TValue>
-	constexpr Tensor<TValue>&& operator+(Tensor<TValue>&& tensor);
 }
@@ -0,0 +1,166 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//! \file
+//! \author Plgrin Marius
+//! \copyright The MIT License (MIT)
+//! \date 2019-2024
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <SciPP/Core/CoreTypes.hpp>
+
+namespace scp
+{
+	namespace _scp
+	{
+		struct TensorExprAdd;
+		struct TensorExprSub;
+		struct TensorExprMul;
+		struct TensorExprDiv;
+		struct TensorExprNeg;
+
+		// Lazy elementwise expressions. They only hold references to the tensors they are built from and are evaluated
+		// in a single loop when assigned to a tensor, so they must not outlive the full expression they appear in: in
+		// auto e = f() + b, e refers to the destroyed result of f(). DenseType is the type of the operands (Matrix for
+		// a sum of matrices...), or Tensor if they differ, and eval gives the expression as a DenseType, for instance
+		// to pass it to a function taking a Matrix.
+		// aliases tells whether writing elementwise into the given elements, strides being null if they are contiguous,
+		// may change elements of the expression before they are read.
+
+		template<typename TValue, typename TDense = Tensor<TValue>>
+		class TensorExprRef
+		{
+			public:
+
+				using IsTensorExpr = bool;
+				using ValueType = TValue;
+				using DenseType = TDense;
+
+				constexpr TensorExprRef(const Tensor<TValue>& tensor);
+				constexpr TensorExprRef(const TensorShape& shape, const TValue* values);
+
+				constexpr const TValue& operator[](uint64_t index) const;
+
+				constexpr const TensorShape& getShape() const;
+				constexpr uint64_t getElementCount() const;
+				template<typename TOther> constexpr bool aliases(const TOther* values, const TensorShape& shape, const int64_t* strides) const;
+
+			private:
+
+				const TensorShape* _shape;
+				uint64_t _length;
+				const TValue* _values;
+		};
+
+		template<typename TOp, typename TExprA, typename TExprB>
+		class TensorExprBinary
+		{
+			public:
+
+				using IsTensorExpr = bool;
+				using ValueType = typename TExprA::ValueType;
+				using DenseType = std::conditional_t<std::same_as<typename TExprA::DenseType, typename TExprB::DenseType>, typename TExprA::DenseType, Tensor<ValueType>>;
+
+				constexpr TensorExprBinary(const TExprA& exprA, const TExprB& exprB);
+
+				constexpr ValueType operator[](uint64_t index) const;
+
+				constexpr const TensorShape& getShape() const;
+				constexpr uint64_t getElementCount() const;
+				template<typename TOther> constexpr bool aliases(const TOther* values, const TensorShape& shape, const int64_t* strides) const;
+
+			private:
+
+				TExprA _exprA;
+				TExprB _exprB;
+		};
+
+		template<typename TOp, typename TExpr, typename TScalar>
+		class TensorExprScalar
+		{
+			public:
+
+				using IsTensorExpr = bool;
+				using ValueType = typename TExpr::ValueType;
+				using DenseType = typename TExpr::DenseType;
+
+				constexpr TensorExprScalar(const TExpr& expr, const TScalar& scalar);
+
+				constexpr ValueType operator[](uint64_t index) const;
+
+				constexpr const TensorShape& getShape() const;
+				constexpr uint64_t getElementCount() const;
+				template<typename TOther> constexpr bool aliases(const TOther* values, const TensorShape& shape, const int64_t* strides) const;
+
+			private:
+
+				TExpr _expr;
+				TScalar _scalar;
+		};
+
+		template<typename TOp, typename TExpr>
+		class TensorExprUnary
+		{
+			public:
+
+				using IsTensorExpr = bool;
+				using ValueType = typename TExpr::ValueType;
+				using DenseType = typename TExpr::DenseType;
+
+				constexpr TensorExprUnary(const TExpr& expr);
+
+				constexpr ValueType operator[](uint64_t index) const;
+
+				constexpr const TensorShape& getShape() const;
+				constexpr uint64_t getElementCount() const;
+				template<typename TOther> constexpr bool aliases(const TOther* values, const TensorShape& shape, const int64_t* strides) const;
+
+			private:
+
+				TExpr _expr;
+		};
+
+		template<CTensorOperand T>
+		constexpr auto toTensorExpr(const T& operand);
+
+		// Whether two sets of elements, strides being null if contiguous, share memory without being the same elements
+		// at the same indices
+		template<typename TValueA, typename TValueB>
+		constexpr bool elementsAlias(const TValueA* valuesA, const TensorShape& shapeA, const int64_t* stridesA, const TValueB* valuesB, const TensorShape& shapeB, const int64_t* stridesB);
+	}
+
+	template<CTensorOperand TA, CTensorOperand TB> requires std::same_as<typename TA::ValueType, typename TB::ValueType>
+	constexpr auto operator+(const TA& a, const TB& b);
+	template<CTensorOperand TA, CTensorOperand TB> requires std::same_as<typename TA::ValueType, typename TB::ValueType>
+	constexpr auto operator-(const TA& a, const TB& b);
+
+	template<CTensorOperand T, typename TScalar> requires (!CTensorOperand<TScalar>)
+	constexpr auto operator*(const T& x, const TScalar& scalar);
+	template<typename TScalar, CTensorOperand T> requires (!CTensorOperand<TScalar>)
+	constexpr auto operator*(const TScalar& scalar, const T& x);
+	template<CTensorOperand T, typename TScalar> requires (!CTensorOperand<TScalar>)
+	constexpr auto operator/(const T& x, const TScalar& scalar);
+
+	template<CTensorOperand T>
+	constexpr auto operator-(const T& x);
+	template<CTensorOperand T>
+	constexpr auto operator+(const T& x);
+
+	template<CTensorOperand T>
+	constexpr auto eval(const T& operand);
+
+	// Matrix and vector products involving expressions, which are evaluated first
+
+	template<CTensorOperand TA, CTensorOperand TB> requires (CTensorExpr<TA> || CTensorExpr<TB>) && std::same_as<typename TA::ValueType, typename TB::ValueType>
+	constexpr auto operator*(const TA& a, const TB& b);
+
+	namespace _scp
+	{
+		// Expressions live in _scp, make the operators reachable by argument dependent lookup
+
+		using scp::operator+;
+		using scp::operator-;
+		using scp::operator*;
+		using scp::operator/;
+	}
+}
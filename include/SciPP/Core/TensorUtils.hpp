@@ -33,6 +33,16 @@ namespace scp
 	// 	// TODO: Mode
 	// };
 
+	namespace _scp
+	{
+		// Order is 0 when it is only known at runtime
+		template<uint64_t Order, bool WithOffset, typename TFunc>
+		constexpr void forEachIndexOfOrder(uint64_t order, const uint64_t* sizes, const int64_t* strides, uint64_t begin, uint64_t end, TFunc& func);
+
+		template<bool WithOffset, typename TFunc>
+		constexpr void forEachIndex(uint64_t order, const uint64_t* sizes, const int64_t* strides, uint64_t begin, uint64_t end, TFunc& func);
+	}
+
 	struct TensorPosition
 	{
 		uint64_t index;
@@ -45,6 +55,7 @@ namespace scp
 
 			constexpr TensorShapeIterator() = delete;
 			constexpr TensorShapeIterator(const TensorShape* shape, bool end);
+			constexpr TensorShapeIterator(const TensorShape* shape, uint64_t index);
 			constexpr TensorShapeIterator(const TensorShapeIterator& iterator);
 			constexpr TensorShapeIterator(TensorShapeIterator&& iterator);
 
@@ -63,8 +74,16 @@ namespace scp
 
 		protected:
 
+			// Indices of shapes up to this order are stored in the iterator itself instead of being allocated
+
+			static constexpr uint64_t _inlineOrder = 8;
+
+			constexpr void _allocate();
+			constexpr void _deallocate();
+
 			const TensorShape* _shape;
 			TensorPosition _pos;
+			uint64_t _buffer[_inlineOrder];
 	};
 
 	struct TensorShape
@@ -77,6 +96,14 @@ namespace scp
 		constexpr void getIndices(uint64_t index, uint64_t* indices) const;
 		constexpr uint64_t getElementCount() const;
 
+		// Calls func(indices, index) for each element of [begin, end) in row-major order, or func(indices, index,
+		// offset) with offset = sum(indices[i] * strides[i]) when strides are given. Indices are kept on the stack and
+		// are only carried at the end of each row, loops being specialized for small orders.
+
+		template<typename TFunc> constexpr void forEach(TFunc&& func) const;
+		template<typename TFunc> constexpr void forEach(uint64_t begin, uint64_t end, TFunc&& func) const;
+		template<typename TFunc> constexpr void forEach(uint64_t begin, uint64_t end, const int64_t* strides, TFunc&& func) const;
+
 		constexpr TensorShapeIterator begin() const;
 		constexpr TensorShapeIterator end() const;
 	};
@@ -0,0 +1,118 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//! \file
+//! \author Plgrin Marius
+//! \copyright The MIT License (MIT)
+//! \date 2019-2024
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <SciPP/Core/CoreTypes.hpp>
+
+namespace scp
+{
+	// Non-owning strided window over the elements of a tensor or of any memory. Copying a view never copies the
+	// elements, but assigning to a view writes through it. TValue may be const-qualified for read-only views.
+
+	template<typename TValue>
+	class TensorView
+	{
+		public:
+
+			using IsTensorExpr = bool;
+			using IsTensorView = bool;
+			using ValueType = std::remove_const_t<TValue>;
+
+			// Construction, copy and move operations
+
+			constexpr TensorView(Tensor<ValueType>& tensor);
+			constexpr TensorView(const Tensor<ValueType>& tensor) requires std::is_const_v<TValue>;
+			constexpr TensorView(uint64_t order, const uint64_t* sizes, const int64_t* strides, TValue* memory);
+			constexpr TensorView(const std::initializer_list<uint64_t>& sizes, const std::initializer_list<int64_t>& strides, TValue* memory);
+			constexpr TensorView(const TensorView<ValueType>& view) requires std::is_const_v<TValue>;
+			constexpr TensorView(const TensorView<TValue>& view);
+			constexpr TensorView(TensorView<TValue>&& view);
+
+			constexpr TensorView<TValue>& operator=(const TensorView<TValue>& view);
+			template<CTensorOperand TOperand> constexpr TensorView<TValue>& operator=(const TOperand& operand);
+
+			// Operators that modifies the viewed elements
+
+			template<CTensorOperand TOperand> constexpr TensorView<TValue>& operator+=(const TOperand& operand);
+			template<CTensorOperand TOperand> constexpr TensorView<TValue>& operator-=(const TOperand& operand);
+			template<typename TScalar> requires (!CTensorOperand<TScalar>) constexpr TensorView<TValue>& operator*=(const TScalar& scalar);
+			template<typename TScalar> requires (!CTensorOperand<TScalar>) constexpr TensorView<TValue>& operator/=(const TScalar& scalar);
+
+			// Views on the same elements
+
+			constexpr TensorView<TValue> slice(uint64_t axis, uint64_t index) const;
+			constexpr TensorView<TValue> range(uint64_t axis, uint64_t begin, uint64_t end, uint64_t step = 1) const;
+			constexpr TensorView<TValue> block(const uint64_t* begins, const uint64_t* sizes) const;
+			constexpr TensorView<TValue> block(const std::initializer_list<uint64_t>& begins, const std::initializer_list<uint64_t>& sizes) const;
+			constexpr TensorView<TValue> transpose(uint64_t i, uint64_t j) const;
+			constexpr TensorView<TValue> permute(const uint64_t* axes) const;
+			constexpr TensorView<TValue> permute(const std::initializer_list<uint64_t>& axes) const;
+			constexpr TensorView<TValue> reshape(uint64_t order, const uint64_t* sizes) const;
+			constexpr TensorView<TValue> reshape(const std::initializer_list<uint64_t>& sizes) const;
+			constexpr TensorView<TValue> diagonal(uint64_t i, uint64_t j) const;
+
+			// Computation-free getters and setters
+
+			constexpr TValue& operator[](uint64_t index) const;
+			constexpr TValue& operator[](const std::initializer_list<uint64_t>& indices) const;
+
+			constexpr TValue& get(uint64_t index) const;
+			constexpr TValue& get(const uint64_t* indices) const;
+			constexpr TValue& get(const std::initializer_list<uint64_t>& indices) const;
+
+			constexpr const TensorShape& getShape() const;
+			constexpr uint64_t getOrder() const;
+			constexpr const uint64_t* getSizes() const;
+			constexpr uint64_t getSize(uint64_t i) const;
+			constexpr const int64_t* getStrides() const;
+			constexpr int64_t getStride(uint64_t i) const;
+			constexpr uint64_t getElementCount() const;
+			constexpr bool isContiguous() const;
+			constexpr TValue* getData() const;
+
+			// Destructor
+
+			constexpr ~TensorView();
+
+		private:
+
+			constexpr int64_t _getOffset(uint64_t index) const;
+			template<typename TFunc> constexpr void _forEach(const TFunc& func) const;
+
+			TensorShape _shape;
+			int64_t* _strides;
+			uint64_t _length;
+			TValue* _values;
+			bool _contiguous;
+	};
+
+	namespace _scp
+	{
+		template<typename TValue>
+		class TensorExprViewRef
+		{
+			public:
+
+				using IsTensorExpr = bool;
+				using ValueType = std::remove_const_t<TValue>;
+				using DenseType = Tensor<ValueType>;
+
+				constexpr TensorExprViewRef(const TensorView<TValue>& view);
+
+				constexpr const ValueType& operator[](uint64_t index) const;
+
+				constexpr const TensorShape& getShape() const;
+				constexpr uint64_t getElementCount() const;
+				template<typename TOther> constexpr bool aliases(const TOther* values, const TensorShape& shape, const int64_t* strides) const;
+
+			private:
+
+				const TensorView<TValue>* _view;
+		};
+	}
+}
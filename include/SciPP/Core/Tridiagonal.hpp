@@ -0,0 +1,41 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//! \file
+//! \author Plgrin Marius
+//! \copyright The MIT License (MIT)
+//! \date 2019-2024
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <SciPP/Core/CoreTypes.hpp>
+
+namespace scp
+{
+	// Solves in place the system lower[i].x[i-1] + diagonal[i].x[i] + upper[i].x[i+1] = b[i] for every line of tensor
+	// along the given axis, with the Thomas algorithm. lower[0] and upper[n-1] are ignored.
+	// The cyclic version makes the indices periodic, lower[0] and upper[n-1] being the coefficients of the corners, and
+	// uses the Sherman-Morrison formula on top of the Thomas algorithm.
+	// Neither pivots, so the matrix should be diagonally dominant. The elimination factors are computed once for all
+	// lines, and neighbouring lines are eliminated together so that the innermost loop is contiguous.
+
+	template<typename TValue>
+	constexpr void solveTridiagonal(const Vector<TValue>& lower, const Vector<TValue>& diagonal, const Vector<TValue>& upper, Tensor<TValue>& tensor, uint64_t axis);
+
+	template<typename TValue>
+	constexpr void solveCyclicTridiagonal(const Vector<TValue>& lower, const Vector<TValue>& diagonal, const Vector<TValue>& upper, Tensor<TValue>& tensor, uint64_t axis);
+
+	namespace _scp
+	{
+		// Elimination factors of the tridiagonal matrix whose first and last diagonal values are replaced by the ones given
+		template<typename TValue>
+		constexpr void tridiagonalFactorize(uint64_t size, const TValue* lower, const TValue* diagonal, const TValue* upper, const TValue& firstDiagonal, const TValue& lastDiagonal, TValue* upperFactors, TValue* reciprocals);
+
+		// Solves count contiguous lines at once, stride being the distance between two consecutive values of a line
+		template<typename TValue>
+		constexpr void tridiagonalSolve(uint64_t size, const TValue* lower, const TValue* upperFactors, const TValue* reciprocals, TValue* x, uint64_t stride, uint64_t count);
+
+		// Calls func(x, stride, count) on batches of contiguous lines covering the tensor along axis, in parallel
+		template<typename TValue, typename TFunc>
+		constexpr void tridiagonalBatches(Tensor<TValue>& tensor, uint64_t axis, uint64_t costPerLine, const TFunc& func);
+	}
+}
@@ -24,9 +24,11 @@ namespace scp
 			constexpr Vector(const std::initializer_list<TValue>& values);
 			constexpr Vector(const Vector<TValue>& vector);
 			constexpr Vector(Vector<TValue>&& vector);
+			template<CTensorExpr TExpr> constexpr Vector(const TExpr& expr);
 
 			constexpr Vector<TValue>& operator=(const Vector<TValue>& vector) = default;
 			constexpr Vector<TValue>& operator=(Vector<TValue>&& vector) = default;
+			template<CTensorExpr TExpr> constexpr Vector<TValue>& operator=(const TExpr& expr);
 
 			constexpr void rightMatrixProduct(const Tensor<TValue>& vector, const Tensor<TValue>& matrix);
 			constexpr void leftMatrixProduct(const Tensor<TValue>& matrix, const Tensor<TValue>& vector);
@@ -44,49 +46,9 @@ namespace scp
 			using Tensor<TValue>::_length;
 			using Tensor<TValue>::_values;
 			using Tensor<TValue>::_owner;
-	};
-
-	template<typename TValue>
-	constexpr Vector<TValue> operator+(const Vector<TValue>& vectorA, const Vector<TValue>& vectorB);
-	template<typename TValue>
-	constexpr Vector<TValue>&& operator+(Vector<TValue>&& vectorA, const Vector<TValue>& vectorB);
-	template<typename TValue>
-	constexpr Vector<TValue>&& operator+(const Vector<TValue>& vectorA, Vector<TValue>&& vectorB);
-	template<typename TValue>
-	constexpr Vector<TValue>&& operator+(Vector<TValue>&& vectorA, Vector<TValue>&& vectorB);
 
-	template<typename TValue>
-	constexpr Vector<TValue> operator-(const Vector<TValue>& vectorA, const Vector<TValue>& vectorB);
-	template<typename TValue>
-	constexpr Vector<TValue>&& operator-(Vector<TValue>&& vectorA, const Vector<TValue>& vectorB);
-	template<typename TValue>
-	constexpr Vector<TValue>&& operator-(const Vector<TValue>& vectorA, Vector<TValue>&& vectorB);
-	template<typename TValue>
-	constexpr Vector<TValue>&& operator-(Vector<TValue>&& vectorA, Vector<TValue>&& vectorB);
-
-	template<typename TValue, typename TScalar>
-	constexpr Vector<TValue> operator*(const Vector<TValue>& vector, const TScalar& scalar);
-	template<typename TValue, typename TScalar>
-	constexpr Vector<TValue>&& operator*(Vector<TValue>&& vector, const TScalar& scalar);
-	template<typename TValue, typename TScalar>
-	constexpr Vector<TValue> operator*(const TScalar& scalar, const Vector<TValue>& vector);
-	template<typename TValue, typename TScalar>
-	constexpr Vector<TValue>&& operator*(const TScalar& scalar, Vector<TValue>&& vector);
-
-	template<typename TValue, typename TScalar>
-	constexpr Vector<TValue> operator/(const Vector<TValue>& vector, const TScalar& scalar);
-	template<typename TValue, typename TScalar>
-	constexpr Vector<TValue>&& operator/(Vector<TValue>&& vector, const TScalar& scalar);
-
-	template<typename TValue>
-	constexpr Vector<TValue> operator-(const Vector<TValue>& vector);
-	template<typename TValue>
-	constexpr Vector<TValue>&& operator-(Vector<TValue>&& vector);
-
-	template<typename TValue>
-	constexpr Vector<TValue> operator+(const Vector<TValue>& vector);
-	template<typename TValue>
-	constexpr Vector<TValue>&& operator+(Vector<TValue>&& vector);
+			using Tensor<TValue>::_detachValues;
+	};
 
 	template<typename TValue>
 	Vector<TValue> operator*(const Vector<TValue>& vector, const Matrix<TValue>& matrix);
@@ -0,0 +1,196 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//! \file
+//! \author Plgrin Marius
+//! \copyright The MIT License (MIT)
+//! \date 2019-2024
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <SciPP/Core/CoreDecl.hpp>
+
+#ifdef __linux__
+	#include <sys/mman.h>
+#endif
+
+namespace scp
+{
+	inline void* AlignedAllocator::allocate(uint64_t size, uint64_t alignment)
+	{
+		return ::operator new(size, std::align_val_t(alignment));
+	}
+
+	inline void AlignedAllocator::deallocate(void* memory, uint64_t size, uint64_t alignment)
+	{
+		::operator delete(memory, size, std::align_val_t(alignment));
+	}
+
+	inline PoolAllocator::PoolAllocator() : PoolAllocator(defaultTensorAllocator)
+	{
+	}
+
+	inline PoolAllocator::PoolAllocator(TensorAllocator& upstream) :
+		_upstream(&upstream),
+		_mutex(),
+		_blocks()
+	{
+	}
+
+	inline void* PoolAllocator::allocate(uint64_t size, uint64_t alignment)
+	{
+		const uint64_t blockSize = _getBlockSize(size);
+
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+
+			auto it = _blocks.find({ blockSize, alignment });
+			if (it != _blocks.end() && !it->second.empty())
+			{
+				void* memory = it->second.back();
+				it->second.pop_back();
+				return memory;
+			}
+		}
+
+		return _upstream->allocate(blockSize, alignment);
+	}
+
+	inline void PoolAllocator::deallocate(void* memory, uint64_t size, uint64_t alignment)
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_blocks[{ _getBlockSize(size), alignment }].push_back(memory);
+	}
+
+	inline void PoolAllocator::release()
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		for (const auto& [key, blocks] : _blocks)
+		{
+			for (void* memory : blocks)
+			{
+				_upstream->deallocate(memory, key.first, key.second);
+			}
+		}
+
+		_blocks.clear();
+	}
+
+	inline PoolAllocator::~PoolAllocator()
+	{
+		release();
+	}
+
+	inline uint64_t PoolAllocator::_getBlockSize(uint64_t size)
+	{
+		return std::bit_ceil(std::max<uint64_t>(size, 64));
+	}
+
+	inline HugePageAllocator::HugePageAllocator(uint64_t threshold, bool reserved) :
+		_threshold(threshold),
+		_reserved(reserved)
+	{
+	}
+
+	inline void* HugePageAllocator::allocate(uint64_t size, uint64_t alignment)
+	{
+		#ifdef __linux__
+			if (size >= _threshold && alignment <= _hugePageSize)
+			{
+				const uint64_t length = (size + _hugePageSize - 1) & ~(_hugePageSize - 1);
+
+				#ifdef MAP_HUGETLB
+					if (_reserved)
+					{
+						void* memory = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+						if (memory != MAP_FAILED)
+						{
+							return memory;
+						}
+					}
+				#endif
+
+				// Map one more huge page and unmap around the aligned range, so that it can be backed by huge pages
+
+				void* mapping = mmap(nullptr, length + _hugePageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+				if (mapping == MAP_FAILED)
+				{
+					throw std::bad_alloc();
+				}
+
+				const uintptr_t begin = reinterpret_cast<uintptr_t>(mapping);
+				const uintptr_t alignedBegin = (begin + _hugePageSize - 1) & ~static_cast<uintptr_t>(_hugePageSize - 1);
+				const uintptr_t end = begin + length + _hugePageSize;
+
+				if (alignedBegin != begin)
+				{
+					munmap(mapping, alignedBegin - begin);
+				}
+				if (alignedBegin + length != end)
+				{
+					munmap(reinterpret_cast<void*>(alignedBegin + length), end - alignedBegin - length);
+				}
+
+				void* memory = reinterpret_cast<void*>(alignedBegin);
+
+				#ifdef MADV_HUGEPAGE
+					madvise(memory, length, MADV_HUGEPAGE);
+				#endif
+
+				return memory;
+			}
+		#endif
+
+		return defaultTensorAllocator.allocate(size, alignment);
+	}
+
+	inline void HugePageAllocator::deallocate(void* memory, uint64_t size, uint64_t alignment)
+	{
+		#ifdef __linux__
+			if (size >= _threshold && alignment <= _hugePageSize)
+			{
+				munmap(memory, (size + _hugePageSize - 1) & ~(_hugePageSize - 1));
+				return;
+			}
+		#endif
+
+		defaultTensorAllocator.deallocate(memory, size, alignment);
+	}
+
+	inline TensorCopyStatistics getTensorCopyStatistics()
+	{
+		return {
+			_scp::tensorCopyCounters.deepCopies.load(std::memory_order_relaxed),
+			_scp::tensorCopyCounters.deferredCopies.load(std::memory_order_relaxed),
+			_scp::tensorCopyCounters.sharedCopies.load(std::memory_order_relaxed),
+			_scp::tensorCopyCounters.copiedBytes.load(std::memory_order_relaxed)
+		};
+	}
+
+	inline void resetTensorCopyStatistics()
+	{
+		_scp::tensorCopyCounters.deepCopies.store(0, std::memory_order_relaxed);
+		_scp::tensorCopyCounters.deferredCopies.store(0, std::memory_order_relaxed);
+		_scp::tensorCopyCounters.sharedCopies.store(0, std::memory_order_relaxed);
+		_scp::tensorCopyCounters.copiedBytes.store(0, std::memory_order_relaxed);
+	}
+
+	namespace _scp
+	{
+		inline void countTensorDeepCopy(const TensorShape& shape, uint64_t size, bool deferred)
+		{
+			(deferred ? tensorCopyCounters.deferredCopies : tensorCopyCounters.deepCopies).fetch_add(1, std::memory_order_relaxed);
+			tensorCopyCounters.copiedBytes.fetch_add(size, std::memory_order_relaxed);
+
+			if (tensorDeepCopyCallback)
+			{
+				tensorDeepCopyCallback(shape, size, deferred);
+			}
+		}
+
+		inline void countTensorSharedCopy()
+		{
+			tensorCopyCounters.sharedCopies.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+}
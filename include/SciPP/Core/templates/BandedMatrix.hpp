@@ -0,0 +1,495 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//! \file
+//! \author Plgrin Marius
+//! \copyright The MIT License (MIT)
+//! \date 2019-2024
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <SciPP/Core/CoreDecl.hpp>
+
+namespace scp
+{
+	template<typename TValue>
+	constexpr BandedMatrix<TValue>::BandedMatrix(uint64_t size, uint64_t lowerBandwidth, uint64_t upperBandwidth) :
+		BandedMatrix<TValue>(size, lowerBandwidth, upperBandwidth, _zero)
+	{
+	}
+
+	template<typename TValue>
+	constexpr BandedMatrix<TValue>::BandedMatrix(uint64_t size, uint64_t lowerBandwidth, uint64_t upperBandwidth, const TValue& value) :
+		_size(size),
+		_lowerBandwidth(lowerBandwidth),
+		_upperBandwidth(upperBandwidth),
+		_bands(size, lowerBandwidth + upperBandwidth + 1, value)
+	{
+		assert(size != 0);
+
+		_clearCorners();
+	}
+
+	template<typename TValue>
+	constexpr BandedMatrix<TValue>::BandedMatrix(const Matrix<TValue>& matrix, uint64_t lowerBandwidth, uint64_t upperBandwidth) :
+		BandedMatrix<TValue>(matrix.getSize(0), lowerBandwidth, upperBandwidth, _zero)
+	{
+		assert(matrix.getSize(0) == matrix.getSize(1));
+
+		const uint64_t width = _lowerBandwidth + _upperBandwidth + 1;
+		const TValue* values = matrix.getData();
+		TValue* bands = _bands.getData();
+
+		for (uint64_t i = 0; i < _size; ++i)
+		{
+			const uint64_t begin = i > _lowerBandwidth ? i - _lowerBandwidth : 0;
+			const uint64_t end = std::min(i + _upperBandwidth + 1, _size);
+
+			std::copy(values + i * _size + begin, values + i * _size + end, bands + i * width + begin + _lowerBandwidth - i);
+		}
+	}
+
+	template<typename TValue>
+	constexpr void BandedMatrix<TValue>::vectorProduct(const Vector<TValue>& vector, Vector<TValue>& result) const
+	{
+		assert(vector.getSize(0) == _size);
+		assert(result.getSize(0) == _size);
+		assert(vector.getData() != result.getData());
+
+		const uint64_t width = _lowerBandwidth + _upperBandwidth + 1;
+		const TValue* bands = _bands.getData();
+		const TValue* x = vector.getData();
+		TValue* y = result.getData();
+
+		_scp::parallelFor(_size, 2 * width, [&](uint64_t begin, uint64_t end)
+		{
+			for (uint64_t i = begin; i < end; ++i)
+			{
+				const uint64_t first = i > _lowerBandwidth ? i - _lowerBandwidth : 0;
+				const uint64_t last = std::min(i + _upperBandwidth + 1, _size);
+				const TValue* row = bands + i * width + first + _lowerBandwidth - i;
+
+				y[i] = _zero;
+				for (uint64_t j = first; j < last; ++j)
+				{
+					y[i] += row[j - first] * x[j];
+				}
+			}
+		});
+	}
+
+	template<typename TValue>
+	constexpr bool BandedMatrix<TValue>::isInBand(uint64_t i, uint64_t j) const
+	{
+		return j + _lowerBandwidth >= i && j <= i + _upperBandwidth;
+	}
+
+	template<typename TValue>
+	constexpr const TValue& BandedMatrix<TValue>::get(uint64_t i, uint64_t j) const
+	{
+		assert(i < _size && j < _size);
+
+		if (!isInBand(i, j))
+		{
+			return _zero;
+		}
+
+		return _bands.get(i * (_lowerBandwidth + _upperBandwidth + 1) + j + _lowerBandwidth - i);
+	}
+
+	template<typename TValue>
+	constexpr void BandedMatrix<TValue>::set(uint64_t i, uint64_t j, const TValue& value)
+	{
+		assert(i < _size && j < _size);
+		assert(isInBand(i, j));
+
+		_bands.set(i * (_lowerBandwidth + _upperBandwidth + 1) + j + _lowerBandwidth - i, value);
+	}
+
+	template<typename TValue>
+	constexpr uint64_t BandedMatrix<TValue>::getSize() const
+	{
+		return _size;
+	}
+
+	template<typename TValue>
+	constexpr uint64_t BandedMatrix<TValue>::getLowerBandwidth() const
+	{
+		return _lowerBandwidth;
+	}
+
+	template<typename TValue>
+	constexpr uint64_t BandedMatrix<TValue>::getUpperBandwidth() const
+	{
+		return _upperBandwidth;
+	}
+
+	template<typename TValue>
+	constexpr const Matrix<TValue>& BandedMatrix<TValue>::getBands() const
+	{
+		return _bands;
+	}
+
+	template<typename TValue>
+	constexpr Matrix<TValue>& BandedMatrix<TValue>::getBands()
+	{
+		return _bands;
+	}
+
+	template<typename TValue>
+	constexpr void BandedMatrix<TValue>::_clearCorners()
+	{
+		const uint64_t width = _lowerBandwidth + _upperBandwidth + 1;
+		TValue* bands = _bands.getData();
+
+		for (uint64_t i = 0; i < _size; ++i)
+		{
+			if (i < _lowerBandwidth)
+			{
+				std::fill_n(bands + i * width, _lowerBandwidth - i, _zero);
+			}
+
+			if (i + _upperBandwidth >= _size)
+			{
+				const uint64_t outside = i + _upperBandwidth + 1 - _size;
+				std::fill_n(bands + (i + 1) * width - outside, outside, _zero);
+			}
+		}
+	}
+
+	template<typename TValue>
+	Vector<TValue> operator*(const BandedMatrix<TValue>& matrix, const Vector<TValue>& vector)
+	{
+		Vector<TValue> result(matrix.getSize());
+		matrix.vectorProduct(vector, result);
+		return result;
+	}
+
+	template<typename TValue>
+	constexpr BandedLU<TValue>::BandedLU(const BandedMatrix<TValue>& matrix) :
+		_lowerBandwidth(matrix.getLowerBandwidth()),
+		_factors(matrix.getSize(), matrix.getLowerBandwidth(), matrix.getLowerBandwidth() + matrix.getUpperBandwidth()),
+		_pivots(matrix.getSize()),
+		_status{ false, false }
+	{
+		const uint64_t size = matrix.getSize();
+		const uint64_t lower = _lowerBandwidth;
+		const uint64_t upper = _factors.getUpperBandwidth();
+		const uint64_t matrixWidth = lower + matrix.getUpperBandwidth() + 1;
+		const uint64_t width = lower + upper + 1;
+
+		// Both band storages start at the same column on each row, the extra upper diagonals stay at zero until fill-in
+
+		const TValue* bands = matrix.getBands().getData();
+		TValue* values = _factors.getBands().getData();
+
+		for (uint64_t i = 0; i < size; ++i)
+		{
+			std::copy_n(bands + i * matrixWidth, matrixWidth, values + i * width);
+		}
+
+		for (uint64_t j = 0; j < size; ++j)
+		{
+			TValue* pivotRow = values + j * width + lower;
+			const uint64_t last = std::min(j + lower + 1, size);
+			const uint64_t length = std::min(j + upper + 1, size) - j;
+
+			uint64_t pivot = j;
+			if constexpr (_scp::HasStdAbs<TValue>)
+			{
+				for (uint64_t i = j + 1; i < last; ++i)
+				{
+					if (std::abs(values[pivot * width + j + lower - pivot]) < std::abs(values[i * width + j + lower - i]))
+					{
+						pivot = i;
+					}
+				}
+			}
+			else
+			{
+				while (pivot + 1 < last && values[pivot * width + j + lower - pivot] == TValue(0))
+				{
+					++pivot;
+				}
+			}
+
+			_pivots[j] = pivot;
+
+			if (pivot != j)
+			{
+				std::swap_ranges(pivotRow, pivotRow + length, values + pivot * width + j + lower - pivot);
+				_status.oddPermutation = !_status.oddPermutation;
+			}
+
+			if (*pivotRow == TValue(0))
+			{
+				_status.singular = true;
+				continue;
+			}
+
+			for (uint64_t i = j + 1; i < last; ++i)
+			{
+				TValue* row = values + i * width + j + lower - i;
+				const TValue factor = *row / *pivotRow;
+
+				*row = factor;
+				if (factor != TValue(0))
+				{
+					for (uint64_t k = 1; k < length; ++k)
+					{
+						row[k] -= factor * pivotRow[k];
+					}
+				}
+			}
+		}
+	}
+
+	template<typename TValue>
+	constexpr void BandedLU<TValue>::solve(Vector<TValue>& b) const
+	{
+		assert(b.getSize(0) == _factors.getSize());
+
+		_solve(b.getData(), 1);
+	}
+
+	template<typename TValue>
+	constexpr void BandedLU<TValue>::solve(Matrix<TValue>& B) const
+	{
+		assert(B.getSize(0) == _factors.getSize());
+
+		_solve(B.getData(), B.getSize(1));
+	}
+
+	template<typename TValue>
+	constexpr TValue BandedLU<TValue>::determinant() const
+	{
+		const uint64_t size = _factors.getSize();
+		const uint64_t width = _lowerBandwidth + _factors.getUpperBandwidth() + 1;
+		const TValue* values = _factors.getBands().getData();
+
+		TValue det = _status.oddPermutation ? TValue(-1) : TValue(1);
+		for (uint64_t i = 0; i < size; ++i)
+		{
+			det *= values[i * width + _lowerBandwidth];
+		}
+
+		return det;
+	}
+
+	template<typename TValue>
+	constexpr bool BandedLU<TValue>::isSingular() const
+	{
+		return _status.singular;
+	}
+
+	template<typename TValue>
+	constexpr const BandedMatrix<TValue>& BandedLU<TValue>::getFactors() const
+	{
+		return _factors;
+	}
+
+	template<typename TValue>
+	constexpr const uint64_t* BandedLU<TValue>::getPivots() const
+	{
+		return _pivots.data();
+	}
+
+	template<typename TValue>
+	constexpr void BandedLU<TValue>::_solve(TValue* x, uint64_t count) const
+	{
+		if (_status.singular)
+		{
+			throw std::runtime_error("The matrix is singular.");
+		}
+
+		const uint64_t size = _factors.getSize();
+		const uint64_t lower = _lowerBandwidth;
+		const uint64_t upper = _factors.getUpperBandwidth();
+		const uint64_t width = lower + upper + 1;
+		const TValue* values = _factors.getBands().getData();
+
+		// The swaps and eliminations are replayed in the order of the factorization
+
+		for (uint64_t j = 0; j < size; ++j)
+		{
+			TValue* xj = x + j * count;
+
+			if (_pivots[j] != j)
+			{
+				std::swap_ranges(xj, xj + count, x + _pivots[j] * count);
+			}
+
+			const uint64_t last = std::min(j + lower + 1, size);
+			for (uint64_t i = j + 1; i < last; ++i)
+			{
+				const TValue& factor = values[i * width + j + lower - i];
+				TValue* xi = x + i * count;
+
+				for (uint64_t k = 0; k < count; ++k)
+				{
+					xi[k] -= factor * xj[k];
+				}
+			}
+		}
+
+		for (uint64_t i = size; i-- > 0;)
+		{
+			const TValue* row = values + i * width + lower;
+			const uint64_t last = std::min(i + upper + 1, size);
+			TValue* xi = x + i * count;
+
+			for (uint64_t j = i + 1; j < last; ++j)
+			{
+				const TValue* xj = x + j * count;
+
+				for (uint64_t k = 0; k < count; ++k)
+				{
+					xi[k] -= row[j - i] * xj[k];
+				}
+			}
+
+			for (uint64_t k = 0; k < count; ++k)
+			{
+				xi[k] /= *row;
+			}
+		}
+	}
+
+	template<typename TValue>
+	constexpr BandedCholesky<TValue>::BandedCholesky(const BandedMatrix<TValue>& matrix) :
+		_factor(matrix.getSize(), matrix.getLowerBandwidth(), 0)
+	{
+		const uint64_t size = matrix.getSize();
+		const uint64_t bandwidth = matrix.getLowerBandwidth();
+		const uint64_t matrixWidth = bandwidth + matrix.getUpperBandwidth() + 1;
+		const uint64_t width = bandwidth + 1;
+
+		const TValue* bands = matrix.getBands().getData();
+		TValue* values = _factor.getBands().getData();
+
+		// Row by row, L(i, j) = (A(i, j) - sum over p < j of L(i, p).L(j, p)) / L(j, j), where both rows of L are
+		// contiguous from column max(i - bandwidth, 0) on
+
+		for (uint64_t i = 0; i < size; ++i)
+		{
+			const uint64_t first = i > bandwidth ? i - bandwidth : 0;
+			TValue* row = values + i * width + bandwidth - i;
+
+			for (uint64_t j = first; j <= i; ++j)
+			{
+				const TValue* rowJ = values + j * width + bandwidth - j;
+
+				TValue sum = bands[i * matrixWidth + j + bandwidth - i];
+				for (uint64_t p = first; p < j; ++p)
+				{
+					sum -= row[p] * rowJ[p];
+				}
+
+				if (j < i)
+				{
+					row[j] = sum / rowJ[j];
+				}
+				else if (sum > TValue(0))
+				{
+					row[j] = std::sqrt(sum);
+				}
+				else
+				{
+					throw std::runtime_error("The matrix is not positive definite.");
+				}
+			}
+		}
+	}
+
+	template<typename TValue>
+	constexpr void BandedCholesky<TValue>::solve(Vector<TValue>& b) const
+	{
+		assert(b.getSize(0) == _factor.getSize());
+
+		_solve(b.getData(), 1);
+	}
+
+	template<typename TValue>
+	constexpr void BandedCholesky<TValue>::solve(Matrix<TValue>& B) const
+	{
+		assert(B.getSize(0) == _factor.getSize());
+
+		_solve(B.getData(), B.getSize(1));
+	}
+
+	template<typename TValue>
+	constexpr TValue BandedCholesky<TValue>::determinant() const
+	{
+		const uint64_t size = _factor.getSize();
+		const uint64_t width = _factor.getLowerBandwidth() + 1;
+		const TValue* values = _factor.getBands().getData();
+
+		TValue det = 1;
+		for (uint64_t i = 0; i < size; ++i)
+		{
+			det *= values[i * width + _factor.getLowerBandwidth()];
+		}
+
+		return det * det;
+	}
+
+	template<typename TValue>
+	constexpr const BandedMatrix<TValue>& BandedCholesky<TValue>::getFactor() const
+	{
+		return _factor;
+	}
+
+	template<typename TValue>
+	constexpr void BandedCholesky<TValue>::_solve(TValue* x, uint64_t count) const
+	{
+		const uint64_t size = _factor.getSize();
+		const uint64_t bandwidth = _factor.getLowerBandwidth();
+		const uint64_t width = bandwidth + 1;
+		const TValue* values = _factor.getBands().getData();
+
+		// L.y = b, then LT.x = y where row i of LT is column i of L
+
+		for (uint64_t i = 0; i < size; ++i)
+		{
+			const uint64_t first = i > bandwidth ? i - bandwidth : 0;
+			const TValue* row = values + i * width + bandwidth - i;
+			TValue* xi = x + i * count;
+
+			for (uint64_t j = first; j < i; ++j)
+			{
+				const TValue* xj = x + j * count;
+
+				for (uint64_t k = 0; k < count; ++k)
+				{
+					xi[k] -= row[j] * xj[k];
+				}
+			}
+
+			for (uint64_t k = 0; k < count; ++k)
+			{
+				xi[k] /= row[i];
+			}
+		}
+
+		for (uint64_t i = size; i-- > 0;)
+		{
+			const uint64_t last = std::min(i + bandwidth + 1, size);
+			TValue* xi = x + i * count;
+
+			for (uint64_t j = i + 1; j < last; ++j)
+			{
+				const TValue& factor = values[j * width + i + bandwidth - j];
+				const TValue* xj = x + j * count;
+
+				for (uint64_t k = 0; k < count; ++k)
+				{
+					xi[k] -= factor * xj[k];
+				}
+			}
+
+			for (uint64_t k = 0; k < count; ++k)
+			{
+				xi[k] /= values[i * width + bandwidth];
+			}
+		}
+	}
+}
@@ -0,0 +1,243 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//! \file
+//! \author Plgrin Marius
+//! \copyright The MIT License (MIT)
+//! \date 2019-2024
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <SciPP/Core/CoreDecl.hpp>
+
+namespace scp
+{
+	inline ThreadPool::ThreadPool(uint64_t threadCount) :
+		_threads(),
+		_dispatchMutex(),
+		_mutex(),
+		_wakeCondition(),
+		_doneCondition(),
+		_task(nullptr),
+		_taskCount(0),
+		_nextTask(0),
+		_busyThreads(0),
+		_generation(0),
+		_stopping(false),
+		_exception(nullptr)
+	{
+		assert(threadCount != 0);
+
+		_threads.reserve(threadCount - 1);
+		for (uint64_t i = 1; i < threadCount; ++i)
+		{
+			_threads.emplace_back(&ThreadPool::_work, this);
+		}
+	}
+
+	inline void ThreadPool::dispatch(uint64_t taskCount, const std::function<void(uint64_t)>& task)
+	{
+		if (_threads.empty() || taskCount <= 1)
+		{
+			for (uint64_t i = 0; i < taskCount; ++i)
+			{
+				task(i);
+			}
+
+			return;
+		}
+
+		// One dispatch at a time: dispatches from several threads wait for each other
+
+		std::lock_guard<std::mutex> dispatchLock(_dispatchMutex);
+
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+
+			_task = &task;
+			_taskCount = taskCount;
+			_nextTask.store(0, std::memory_order_relaxed);
+			_busyThreads = _threads.size();
+			_exception = nullptr;
+			++_generation;
+		}
+
+		_wakeCondition.notify_all();
+		_runTasks();
+
+		std::exception_ptr exception;
+
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_doneCondition.wait(lock, [&]() { return _busyThreads == 0; });
+
+			_task = nullptr;
+			std::swap(exception, _exception);
+		}
+
+		if (exception)
+		{
+			std::rethrow_exception(exception);
+		}
+	}
+
+	inline std::function<void(uint64_t, const std::function<void(uint64_t)>&)> ThreadPool::getDispatcher()
+	{
+		return [this](uint64_t taskCount, const std::function<void(uint64_t)>& task)
+		{
+			dispatch(taskCount, task);
+		};
+	}
+
+	inline uint64_t ThreadPool::getThreadCount() const
+	{
+		return _threads.size() + 1;
+	}
+
+	inline ThreadPool::~ThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_stopping = true;
+		}
+
+		_wakeCondition.notify_all();
+
+		for (std::thread& thread : _threads)
+		{
+			thread.join();
+		}
+	}
+
+	inline void ThreadPool::_work()
+	{
+		uint64_t generation = 0;
+
+		while (true)
+		{
+			{
+				std::unique_lock<std::mutex> lock(_mutex);
+				_wakeCondition.wait(lock, [&]() { return _stopping || _generation != generation; });
+
+				if (_stopping)
+				{
+					return;
+				}
+
+				generation = _generation;
+			}
+
+			_runTasks();
+
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				if (--_busyThreads == 0)
+				{
+					_doneCondition.notify_one();
+				}
+			}
+		}
+	}
+
+	inline void ThreadPool::_runTasks()
+	{
+		// Tasks are taken one by one, so that threads finishing early take over the remaining ones
+
+		for (uint64_t i = _nextTask.fetch_add(1, std::memory_order_relaxed); i < _taskCount; i = _nextTask.fetch_add(1, std::memory_order_relaxed))
+		{
+			try
+			{
+				(*_task)(i);
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				if (!_exception)
+				{
+					_exception = std::current_exception();
+				}
+			}
+		}
+	}
+
+	namespace _scp
+	{
+		inline bool& isInParallelTask()
+		{
+			static thread_local bool inTask = false;
+			return inTask;
+		}
+
+		// Marks the current thread as running a task until destroyed, even if the task throws
+
+		class ParallelTaskGuard
+		{
+			public:
+
+				ParallelTaskGuard() :
+					_wasInTask(isInParallelTask())
+				{
+					isInParallelTask() = true;
+				}
+
+				ParallelTaskGuard(const ParallelTaskGuard& guard) = delete;
+				ParallelTaskGuard(ParallelTaskGuard&& guard) = delete;
+
+				ParallelTaskGuard& operator=(const ParallelTaskGuard& guard) = delete;
+				ParallelTaskGuard& operator=(ParallelTaskGuard&& guard) = delete;
+
+				~ParallelTaskGuard()
+				{
+					isInParallelTask() = _wasInTask;
+				}
+
+			private:
+
+				bool _wasInTask;
+		};
+
+		// First item of a task when count items are split evenly in taskCount tasks, without overflowing count * task
+
+		constexpr uint64_t getTaskBegin(uint64_t count, uint64_t taskCount, uint64_t task)
+		{
+			return (count / taskCount) * task + ((count % taskCount) * task) / taskCount;
+		}
+
+		template<typename TFunc>
+		constexpr void parallelFor(uint64_t count, uint64_t costPerItem, const TFunc& func)
+		{
+			if consteval
+			{
+				func(0, count);
+			}
+			else
+			{
+				// Nested calls run serially so that a dispatcher waiting for its own tasks cannot deadlock
+
+				uint64_t taskCount = 1;
+				if (exec.dispatcher && exec.concurrency > 1 && !isInParallelTask())
+				{
+					const uint64_t cost = costPerItem != 0 && count > UINT64_MAX / costPerItem ? UINT64_MAX : count * costPerItem;
+					taskCount = std::min(std::min(exec.concurrency, count), cost / std::max<uint64_t>(exec.grainSize, 1));
+				}
+
+				if (taskCount <= 1)
+				{
+					func(0, count);
+					return;
+				}
+
+				exec.dispatcher(taskCount, [&](uint64_t task)
+				{
+					const ParallelTaskGuard guard;
+					func(getTaskBegin(count, taskCount, task), getTaskBegin(count, taskCount, task + 1));
+				});
+			}
+		}
+
+		template<typename TFunc>
+		constexpr void parallelFor(uint64_t count, const TFunc& func)
+		{
+			parallelFor(count, 1, func);
+		}
+	}
+}
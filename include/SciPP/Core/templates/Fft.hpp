@@ -0,0 +1,793 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//! \file
+//! \author Plgrin Marius
+//! \copyright The MIT License (MIT)
+//! \date 2019-2024
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <SciPP/Core/CoreDecl.hpp>
+
+namespace scp
+{
+	namespace _scp
+	{
+		template<CComplex TValue>
+		constexpr TValue fftRoot(uint64_t k, uint64_t n)
+		{
+			using TReal = typename TValue::value_type;
+
+			// exp(-2i.pi.k/n), computed directly in extended precision instead of by repeated multiplication
+
+			k %= n;
+			const long double angle = -2 * std::numbers::pi_v<long double> * k / n;
+			return TValue(static_cast<TReal>(std::cos(angle)), static_cast<TReal>(std::sin(angle)));
+		}
+
+		constexpr uint64_t fftFastSize(uint64_t size)
+		{
+			for (;; ++size)
+			{
+				uint64_t n = size;
+				for (const uint64_t factor : { 2, 3, 5 })
+				{
+					while (n % factor == 0)
+					{
+						n /= factor;
+					}
+				}
+
+				if (n == 1)
+				{
+					return size;
+				}
+			}
+		}
+
+		template<typename TSizesA, typename TSizesB>
+		constexpr bool FftSizesLess::operator()(const TSizesA& sizesA, const TSizesB& sizesB) const
+		{
+			return std::lexicographical_compare(sizesA.begin(), sizesA.end(), sizesB.begin(), sizesB.end());
+		}
+
+		template<CComplex TValue>
+		constexpr TValue fftMultiply(const TValue& x, const TValue& y)
+		{
+			return TValue(x.real() * y.real() - x.imag() * y.imag(), x.real() * y.imag() + x.imag() * y.real());
+		}
+
+		template<CComplex TValue>
+		constexpr TValue fftRotate(const TValue& x)
+		{
+			// -i.x
+			return TValue(x.imag(), -x.real());
+		}
+
+		template<CComplex TValue>
+		constexpr void fftButterflies(uint64_t radix, const TValue* src, uint64_t srcStride, TValue* dst, uint64_t dstStride, const TValue* twiddles, const TValue* roots, uint64_t count, TValue* tmp)
+		{
+			using TReal = typename TValue::value_type;
+
+			uint64_t i = 0;
+
+			if constexpr (CSimdValue<TValue>)
+			{
+				if !consteval
+				{
+					if (count > 1)
+					{
+						switch (radix)
+						{
+							case 2: i = simdFftRadix2(src, srcStride, dst, dstStride, twiddles, count); break;
+							case 4: i = simdFftRadix4(src, srcStride, dst, dstStride, twiddles, count); break;
+							case 8: i = simdFftRadix8(src, srcStride, dst, dstStride, twiddles, count); break;
+							default: break;
+						}
+					}
+				}
+			}
+
+			for (; i < count; ++i)
+			{
+				const TValue* x = src + i;
+				TValue* y = dst + i;
+
+				if (radix == 2)
+				{
+					const TValue a0 = x[0];
+					const TValue a1 = x[srcStride];
+
+					y[0] = a0 + a1;
+					y[dstStride] = fftMultiply(a0 - a1, twiddles[0]);
+				}
+				else if (radix == 3)
+				{
+					constexpr TReal halfSqrt3 = std::numbers::sqrt3_v<TReal> / 2;
+
+					const TValue a0 = x[0];
+					const TValue sum = x[srcStride] + x[2 * srcStride];
+					const TValue diff = x[srcStride] - x[2 * srcStride];
+					const TValue mid = a0 - sum * TReal(0.5);
+					const TValue rot = fftRotate(diff) * halfSqrt3;
+
+					y[0] = a0 + sum;
+					y[dstStride] = fftMultiply(mid + rot, twiddles[0]);
+					y[2 * dstStride] = fftMultiply(mid - rot, twiddles[1]);
+				}
+				else if (radix == 4)
+				{
+					const TValue b0 = x[0] + x[2 * srcStride];
+					const TValue b1 = x[0] - x[2 * srcStride];
+					const TValue b2 = x[srcStride] + x[3 * srcStride];
+					const TValue b3 = fftRotate(x[srcStride] - x[3 * srcStride]);
+
+					y[0] = b0 + b2;
+					y[dstStride] = fftMultiply(b1 + b3, twiddles[0]);
+					y[2 * dstStride] = fftMultiply(b0 - b2, twiddles[1]);
+					y[3 * dstStride] = fftMultiply(b1 - b3, twiddles[2]);
+				}
+				else if (radix == 8)
+				{
+					constexpr TReal halfSqrt2 = std::numbers::sqrt2_v<TReal> / 2;
+
+					const TValue e0 = x[0] + x[4 * srcStride];
+					const TValue e1 = x[srcStride] + x[5 * srcStride];
+					const TValue e2 = x[2 * srcStride] + x[6 * srcStride];
+					const TValue e3 = x[3 * srcStride] + x[7 * srcStride];
+					const TValue o0 = x[0] - x[4 * srcStride];
+					const TValue o1 = fftMultiply(x[srcStride] - x[5 * srcStride], TValue(halfSqrt2, -halfSqrt2));
+					const TValue o2 = fftRotate(x[2 * srcStride] - x[6 * srcStride]);
+					const TValue o3 = fftMultiply(x[3 * srcStride] - x[7 * srcStride], TValue(-halfSqrt2, -halfSqrt2));
+
+					const TValue eA = e0 + e2;
+					const TValue eB = e0 - e2;
+					const TValue eC = e1 + e3;
+					const TValue eD = fftRotate(e1 - e3);
+					const TValue oA = o0 + o2;
+					const TValue oB = o0 - o2;
+					const TValue oC = o1 + o3;
+					const TValue oD = fftRotate(o1 - o3);
+
+					y[0] = eA + eC;
+					y[dstStride] = fftMultiply(oA + oC, twiddles[0]);
+					y[2 * dstStride] = fftMultiply(eB + eD, twiddles[1]);
+					y[3 * dstStride] = fftMultiply(oB + oD, twiddles[2]);
+					y[4 * dstStride] = fftMultiply(eA - eC, twiddles[3]);
+					y[5 * dstStride] = fftMultiply(oA - oC, twiddles[4]);
+					y[6 * dstStride] = fftMultiply(eB - eD, twiddles[5]);
+					y[7 * dstStride] = fftMultiply(oB - oD, twiddles[6]);
+				}
+				else
+				{
+					for (uint64_t k = 0; k < radix; ++k)
+					{
+						tmp[k] = x[k * srcStride];
+					}
+
+					for (uint64_t l = 0; l < radix; ++l)
+					{
+						TValue sum = tmp[0];
+						uint64_t rootIndex = 0;
+						for (uint64_t k = 1; k < radix; ++k)
+						{
+							rootIndex += l;
+							if (rootIndex >= radix)
+							{
+								rootIndex -= radix;
+							}
+
+							sum += fftMultiply(tmp[k], roots[rootIndex]);
+						}
+
+						y[l * dstStride] = (l == 0) ? sum : fftMultiply(sum, twiddles[l - 1]);
+					}
+				}
+			}
+		}
+
+		template<CComplex TValue>
+		constexpr FftAxis<TValue>::FftAxis(uint64_t size) :
+			_size(size),
+			_maxRadix(1),
+			_radices(),
+			_twiddles(),
+			_chirpAxis(),
+			_chirp(),
+			_chirpSpectrum()
+		{
+			assert(size != 0);
+
+			std::vector<std::pair<uint64_t, uint64_t>> factors;
+			if (size > 1)
+			{
+				primeFactors(size, factors);
+			}
+
+			// Bluestein: X_k = w_k.sum_j(x_j.w_j.conj(w_(k-j))) with w_k = exp(-i.pi.k^2/n), the convolution being
+			// computed circularly on a power of two length of at least 2n-1
+
+			if (!factors.empty() && factors.back().first > _bluesteinThreshold)
+			{
+				uint64_t convolutionSize = 1;
+				while (convolutionSize < 2 * size - 1)
+				{
+					convolutionSize <<= 1;
+				}
+
+				_chirpAxis.emplace_back(convolutionSize);
+
+				_chirp.resize(size);
+				for (uint64_t k = 0; k < size; ++k)
+				{
+					_chirp[k] = fftRoot<TValue>((k * k) % (2 * size), 2 * size);
+				}
+
+				_chirpSpectrum.assign(convolutionSize, TValue(0));
+				_chirpSpectrum[0] = std::conj(_chirp[0]);
+				for (uint64_t k = 1; k < size; ++k)
+				{
+					_chirpSpectrum[k] = std::conj(_chirp[k]);
+					_chirpSpectrum[convolutionSize - k] = std::conj(_chirp[k]);
+				}
+
+				ScratchBuffer<TValue> chirpScratch(_chirpAxis.front().getScratchSize());
+				_chirpAxis.front().execute(_chirpSpectrum.data(), 1, false, chirpScratch.getData());
+
+				return;
+			}
+
+			// Factorize: odd primes first, then the powers of two as radix 8 passes, which have the best kernels
+
+			uint64_t twoCount = 0;
+			for (const std::pair<uint64_t, uint64_t>& factor : factors)
+			{
+				if (factor.first == 2)
+				{
+					twoCount = factor.second;
+				}
+				else
+				{
+					_radices.insert(_radices.end(), factor.second, factor.first);
+				}
+			}
+
+			if (twoCount % 3 != 0)
+			{
+				_radices.push_back(uint64_t(1) << (twoCount % 3));
+			}
+			_radices.insert(_radices.end(), twoCount / 3, 8);
+
+			_maxRadix = _radices.empty() ? 1 : *std::max_element(_radices.begin(), _radices.end());
+
+			// Tables of each pass: the radix-th roots of unity, then W_length^(p.l) for each p and each l != 0
+
+			uint64_t length = size;
+			for (const uint64_t radix : _radices)
+			{
+				const uint64_t subLength = length / radix;
+
+				for (uint64_t j = 0; j < radix; ++j)
+				{
+					_twiddles.push_back(fftRoot<TValue>(j, radix));
+				}
+
+				for (uint64_t p = 0; p < subLength; ++p)
+				{
+					for (uint64_t l = 1; l < radix; ++l)
+					{
+						_twiddles.push_back(fftRoot<TValue>(p * l, length));
+					}
+				}
+
+				length = subLength;
+			}
+		}
+
+		template<CComplex TValue>
+		constexpr void FftAxis<TValue>::execute(TValue* data, uint64_t stride, bool inverse, TValue* scratch) const
+		{
+			using TReal = typename TValue::value_type;
+
+			if (!_chirpAxis.empty())
+			{
+				_executeBluestein(data, stride, inverse, scratch);
+				return;
+			}
+
+			// The inverse transform is computed as conj(fft(conj(x))) / n, the conjugations being merged with the copies
+
+			TValue* src = scratch;
+			TValue* dst = scratch + _size;
+			TValue* tmp = scratch + 2 * _size;
+
+			if (inverse)
+			{
+				for (uint64_t i = 0; i < _size; ++i)
+				{
+					src[i] = std::conj(data[i * stride]);
+				}
+			}
+			else
+			{
+				for (uint64_t i = 0; i < _size; ++i)
+				{
+					src[i] = data[i * stride];
+				}
+			}
+
+			// Pass with radix r on sub-sequences of the given length: for each p < length/r and each of the subStride
+			// interleaved sub-sequences, r inputs spaced by length/r are combined into r consecutive outputs
+
+			const TValue* twiddles = _twiddles.data();
+			uint64_t length = _size;
+			uint64_t subStride = 1;
+
+			for (const uint64_t radix : _radices)
+			{
+				const uint64_t subLength = length / radix;
+				const TValue* roots = twiddles;
+				const TValue* w = twiddles + radix;
+
+				for (uint64_t p = 0; p < subLength; ++p, w += radix - 1)
+				{
+					fftButterflies(radix, src + subStride * p, subStride * subLength, dst + subStride * radix * p, subStride, w, roots, subStride, tmp);
+				}
+
+				twiddles += radix + subLength * (radix - 1);
+				length = subLength;
+				subStride *= radix;
+
+				std::swap(src, dst);
+			}
+
+			if (inverse)
+			{
+				const TReal factor = TReal(1) / _size;
+				for (uint64_t i = 0; i < _size; ++i)
+				{
+					data[i * stride] = std::conj(src[i]) * factor;
+				}
+			}
+			else
+			{
+				for (uint64_t i = 0; i < _size; ++i)
+				{
+					data[i * stride] = src[i];
+				}
+			}
+		}
+
+		template<CComplex TValue>
+		constexpr uint64_t FftAxis<TValue>::getSize() const
+		{
+			return _size;
+		}
+
+		template<CComplex TValue>
+		constexpr uint64_t FftAxis<TValue>::getScratchSize() const
+		{
+			if (!_chirpAxis.empty())
+			{
+				return _chirpAxis.front().getSize() + _chirpAxis.front().getScratchSize();
+			}
+
+			return 2 * _size + _maxRadix;
+		}
+
+		template<CComplex TValue>
+		constexpr void FftAxis<TValue>::_executeBluestein(TValue* data, uint64_t stride, bool inverse, TValue* scratch) const
+		{
+			using TReal = typename TValue::value_type;
+
+			const FftAxis<TValue>& chirpAxis = _chirpAxis.front();
+			const uint64_t convolutionSize = chirpAxis.getSize();
+			TValue* buffer = scratch;
+
+			for (uint64_t k = 0; k < _size; ++k)
+			{
+				const TValue x = inverse ? std::conj(data[k * stride]) : data[k * stride];
+				buffer[k] = fftMultiply(x, _chirp[k]);
+			}
+			std::fill(buffer + _size, buffer + convolutionSize, TValue(0));
+
+			chirpAxis.execute(buffer, 1, false, scratch + convolutionSize);
+			for (uint64_t k = 0; k < convolutionSize; ++k)
+			{
+				buffer[k] = fftMultiply(buffer[k], _chirpSpectrum[k]);
+			}
+			chirpAxis.execute(buffer, 1, true, scratch + convolutionSize);
+
+			if (inverse)
+			{
+				const TReal factor = TReal(1) / _size;
+				for (uint64_t k = 0; k < _size; ++k)
+				{
+					data[k * stride] = std::conj(fftMultiply(buffer[k], _chirp[k])) * factor;
+				}
+			}
+			else
+			{
+				for (uint64_t k = 0; k < _size; ++k)
+				{
+					data[k * stride] = fftMultiply(buffer[k], _chirp[k]);
+				}
+			}
+		}
+
+		template<CComplex TValue>
+		constexpr FftRealAxis<TValue>::FftRealAxis(uint64_t size) :
+			_size(size),
+			_axis(size % 2 == 0 ? size / 2 : size),
+			_twiddles()
+		{
+			if (size % 2 == 0)
+			{
+				_twiddles.resize(size / 2 + 1);
+				for (uint64_t k = 0; k <= size / 2; ++k)
+				{
+					_twiddles[k] = fftRoot<TValue>(k, size);
+				}
+			}
+		}
+
+		template<CComplex TValue>
+		constexpr void FftRealAxis<TValue>::forward(const typename TValue::value_type* input, TValue* output, TValue* scratch) const
+		{
+			using TReal = typename TValue::value_type;
+
+			if (_size % 2 != 0)
+			{
+				std::copy_n(input, _size, scratch);
+				_axis.execute(scratch, 1, false, scratch + _size);
+				std::copy_n(scratch, _size / 2 + 1, output);
+				return;
+			}
+
+			// Transform the even and odd samples at once as the real and imaginary parts of a half size line, then
+			// separate the two spectra using their hermitian symmetry: Z[k] = E[k] + i.O[k] and X[k] = E[k] + W^k.O[k]
+
+			const uint64_t half = _size / 2;
+			for (uint64_t k = 0; k < half; ++k)
+			{
+				output[k] = TValue(input[2 * k], input[2 * k + 1]);
+			}
+
+			_axis.execute(output, 1, false, scratch);
+
+			const TValue z0 = output[0];
+			output[0] = TValue(z0.real() + z0.imag(), 0);
+			output[half] = TValue(z0.real() - z0.imag(), 0);
+
+			for (uint64_t k = 1; k <= half / 2; ++k)
+			{
+				const uint64_t j = half - k;
+
+				const TValue a = output[k];
+				const TValue b = output[j];
+				const TValue even = (a + std::conj(b)) * TReal(0.5);
+				const TValue diff = (a - std::conj(b)) * TReal(0.5);
+				const TValue odd(diff.imag(), -diff.real());
+
+				output[k] = even + _twiddles[k] * odd;
+				output[j] = std::conj(even) + _twiddles[j] * std::conj(odd);
+			}
+		}
+
+		template<CComplex TValue>
+		constexpr void FftRealAxis<TValue>::backward(const TValue* input, typename TValue::value_type* output, TValue* scratch) const
+		{
+			using TReal = typename TValue::value_type;
+
+			if (_size % 2 != 0)
+			{
+				scratch[0] = input[0];
+				for (uint64_t k = 1; k <= _size / 2; ++k)
+				{
+					scratch[k] = input[k];
+					scratch[_size - k] = std::conj(input[k]);
+				}
+
+				_axis.execute(scratch, 1, true, scratch + _size);
+
+				for (uint64_t k = 0; k < _size; ++k)
+				{
+					output[k] = scratch[k].real();
+				}
+
+				return;
+			}
+
+			const uint64_t half = _size / 2;
+			for (uint64_t k = 0; k < half; ++k)
+			{
+				const TValue a = input[k];
+				const TValue b = std::conj(input[half - k]);
+				const TValue even = (a + b) * TReal(0.5);
+				const TValue odd = (a - b) * std::conj(_twiddles[k]) * TReal(0.5);
+
+				scratch[k] = even + TValue(-odd.imag(), odd.real());
+			}
+
+			_axis.execute(scratch, 1, true, scratch + half);
+
+			for (uint64_t k = 0; k < half; ++k)
+			{
+				output[2 * k] = scratch[k].real();
+				output[2 * k + 1] = scratch[k].imag();
+			}
+		}
+
+		template<CComplex TValue>
+		constexpr uint64_t FftRealAxis<TValue>::getSize() const
+		{
+			return _size;
+		}
+
+		template<CComplex TValue>
+		constexpr uint64_t FftRealAxis<TValue>::getScratchSize() const
+		{
+			return _axis.getSize() + _axis.getScratchSize();
+		}
+
+		template<CComplex TValue>
+		constexpr void fftLines(const FftAxis<TValue>& axis, TValue* data, uint64_t outerCount, uint64_t innerCount, bool inverse)
+		{
+			const uint64_t size = axis.getSize();
+			if (size == 1)
+			{
+				return;
+			}
+
+			const uint64_t blockWidth = std::min(innerCount, fftBlockSize);
+			const uint64_t blockCount = (innerCount + blockWidth - 1) / blockWidth;
+			const uint64_t blockCost = blockWidth * size * std::bit_width(size);
+
+			parallelFor(outerCount * blockCount, blockCost, [&](uint64_t begin, uint64_t end)
+			{
+				ScratchBuffer<TValue> scratch(axis.getScratchSize() + (innerCount == 1 ? 0 : blockWidth * size));
+				TValue* block = scratch.getData() + axis.getScratchSize();
+
+				for (uint64_t i = begin; i < end; ++i)
+				{
+					const uint64_t firstLine = (i % blockCount) * blockWidth;
+					TValue* lines = data + (i / blockCount) * size * innerCount + firstLine;
+
+					if (innerCount == 1)
+					{
+						axis.execute(lines, 1, inverse, scratch.getData());
+						continue;
+					}
+
+					const uint64_t width = std::min(blockWidth, innerCount - firstLine);
+
+					for (uint64_t k = 0; k < size; ++k)
+					{
+						std::copy_n(lines + k * innerCount, width, block + k * width);
+					}
+
+					for (uint64_t j = 0; j < width; ++j)
+					{
+						axis.execute(block + j, width, inverse, scratch.getData());
+					}
+
+					for (uint64_t k = 0; k < size; ++k)
+					{
+						std::copy_n(block + k * width, width, lines + k * innerCount);
+					}
+				}
+			});
+		}
+	}
+
+	template<CComplex TValue>
+	FftPlan<TValue>& FftPlan<TValue>::getCached(const TensorShape& shape)
+	{
+		std::map<std::vector<uint64_t>, FftPlan<TValue>, _scp::FftSizesLess>& cache = _getCache();
+
+		const std::span<const uint64_t> sizes(shape.sizes, shape.order);
+		auto it = cache.find(sizes);
+		if (it == cache.end())
+		{
+			it = cache.emplace(std::vector<uint64_t>(sizes.begin(), sizes.end()), FftPlan<TValue>(shape.order, shape.sizes)).first;
+		}
+
+		return it->second;
+	}
+
+	template<CComplex TValue>
+	void FftPlan<TValue>::clearCache()
+	{
+		_getCache().clear();
+	}
+
+	template<CComplex TValue>
+	constexpr FftPlan<TValue>::FftPlan(uint64_t order, const uint64_t* sizes) :
+		_sizes(sizes, sizes + order),
+		_axes()
+	{
+		assert(order != 0);
+
+		for (uint64_t i = 0; i < order; ++i)
+		{
+			_axes.emplace_back(sizes[i]);
+		}
+	}
+
+	template<CComplex TValue>
+	constexpr FftPlan<TValue>::FftPlan(const std::initializer_list<uint64_t>& sizes) : FftPlan<TValue>(sizes.size(), sizes.begin())
+	{
+	}
+
+	template<CComplex TValue>
+	constexpr void FftPlan<TValue>::forward(TValue* data)
+	{
+		_execute(data, false);
+	}
+
+	template<CComplex TValue>
+	constexpr void FftPlan<TValue>::backward(TValue* data)
+	{
+		_execute(data, true);
+	}
+
+	template<CComplex TValue>
+	constexpr uint64_t FftPlan<TValue>::getOrder() const
+	{
+		return _sizes.size();
+	}
+
+	template<CComplex TValue>
+	constexpr const uint64_t* FftPlan<TValue>::getSizes() const
+	{
+		return _sizes.data();
+	}
+
+	template<CComplex TValue>
+	std::map<std::vector<uint64_t>, FftPlan<TValue>, _scp::FftSizesLess>& FftPlan<TValue>::_getCache()
+	{
+		static thread_local std::map<std::vector<uint64_t>, FftPlan<TValue>, _scp::FftSizesLess> cache;
+		return cache;
+	}
+
+	template<CComplex TValue>
+	constexpr void FftPlan<TValue>::_execute(TValue* data, bool inverse)
+	{
+		uint64_t outerCount = 1;
+		uint64_t innerCount = std::accumulate(_sizes.begin(), _sizes.end(), uint64_t(1), std::multiplies<uint64_t>());
+
+		for (uint64_t i = 0; i < _sizes.size(); ++i)
+		{
+			innerCount /= _sizes[i];
+			_scp::fftLines(_axes[i], data, outerCount, innerCount, inverse);
+			outerCount *= _sizes[i];
+		}
+	}
+
+	template<std::floating_point TReal>
+	RealFftPlan<TReal>& RealFftPlan<TReal>::getCached(const TensorShape& shape)
+	{
+		std::map<std::vector<uint64_t>, RealFftPlan<TReal>, _scp::FftSizesLess>& cache = _getCache();
+
+		const std::span<const uint64_t> sizes(shape.sizes, shape.order);
+		auto it = cache.find(sizes);
+		if (it == cache.end())
+		{
+			it = cache.emplace(std::vector<uint64_t>(sizes.begin(), sizes.end()), RealFftPlan<TReal>(shape.order, shape.sizes)).first;
+		}
+
+		return it->second;
+	}
+
+	template<std::floating_point TReal>
+	void RealFftPlan<TReal>::clearCache()
+	{
+		_getCache().clear();
+	}
+
+	template<std::floating_point TReal>
+	constexpr RealFftPlan<TReal>::RealFftPlan(uint64_t order, const uint64_t* sizes) :
+		_sizes(sizes, sizes + order),
+		_axes(),
+		_lastAxis(sizes[order - 1]),
+		_spectrum()
+	{
+		assert(order != 0);
+
+		for (uint64_t i = 0; i < order - 1; ++i)
+		{
+			_axes.emplace_back(sizes[i]);
+		}
+
+		_spectrum.resize(std::accumulate(sizes, sizes + order - 1, getSpectrumSize(order - 1), std::multiplies<uint64_t>()));
+	}
+
+	template<std::floating_point TReal>
+	constexpr RealFftPlan<TReal>::RealFftPlan(const std::initializer_list<uint64_t>& sizes) : RealFftPlan<TReal>(sizes.size(), sizes.begin())
+	{
+	}
+
+	template<std::floating_point TReal>
+	constexpr void RealFftPlan<TReal>::forward(const TReal* input, std::complex<TReal>* output)
+	{
+		const uint64_t order = _sizes.size();
+		const uint64_t size = _sizes.back();
+		const uint64_t spectrumSize = getSpectrumSize(order - 1);
+		const uint64_t lineCount = _spectrum.size() / spectrumSize;
+
+		_scp::parallelFor(lineCount, size * std::bit_width(size), [&](uint64_t begin, uint64_t end)
+		{
+			_scp::ScratchBuffer<std::complex<TReal>> scratch(_lastAxis.getScratchSize());
+			for (uint64_t i = begin; i < end; ++i)
+			{
+				_lastAxis.forward(input + i * size, output + i * spectrumSize, scratch.getData());
+			}
+		});
+
+		uint64_t outerCount = 1;
+		uint64_t innerCount = _spectrum.size();
+
+		for (uint64_t i = 0; i < order - 1; ++i)
+		{
+			innerCount /= _sizes[i];
+			_scp::fftLines(_axes[i], output, outerCount, innerCount, false);
+			outerCount *= _sizes[i];
+		}
+	}
+
+	template<std::floating_point TReal>
+	constexpr void RealFftPlan<TReal>::backward(const std::complex<TReal>* input, TReal* output)
+	{
+		const uint64_t order = _sizes.size();
+		const uint64_t size = _sizes.back();
+		const uint64_t spectrumSize = getSpectrumSize(order - 1);
+		const uint64_t lineCount = _spectrum.size() / spectrumSize;
+
+		std::copy(input, input + _spectrum.size(), _spectrum.begin());
+
+		uint64_t outerCount = 1;
+		uint64_t innerCount = _spectrum.size();
+
+		for (uint64_t i = 0; i < order - 1; ++i)
+		{
+			innerCount /= _sizes[i];
+			_scp::fftLines(_axes[i], _spectrum.data(), outerCount, innerCount, true);
+			outerCount *= _sizes[i];
+		}
+
+		_scp::parallelFor(lineCount, size * std::bit_width(size), [&](uint64_t begin, uint64_t end)
+		{
+			_scp::ScratchBuffer<std::complex<TReal>> scratch(_lastAxis.getScratchSize());
+			for (uint64_t i = begin; i < end; ++i)
+			{
+				_lastAxis.backward(_spectrum.data() + i * spectrumSize, output + i * size, scratch.getData());
+			}
+		});
+	}
+
+	template<std::floating_point TReal>
+	constexpr uint64_t RealFftPlan<TReal>::getOrder() const
+	{
+		return _sizes.size();
+	}
+
+	template<std::floating_point TReal>
+	constexpr const uint64_t* RealFftPlan<TReal>::getSizes() const
+	{
+		return _sizes.data();
+	}
+
+	template<std::floating_point TReal>
+	constexpr uint64_t RealFftPlan<TReal>::getSpectrumSize(uint64_t i) const
+	{
+		assert(i < _sizes.size());
+		return i == _sizes.size() - 1 ? _sizes[i] / 2 + 1 : _sizes[i];
+	}
+
+	template<std::floating_point TReal>
+	std::map<std::vector<uint64_t>, RealFftPlan<TReal>, _scp::FftSizesLess>& RealFftPlan<TReal>::_getCache()
+	{
+		static thread_local std::map<std::vector<uint64_t>, RealFftPlan<TReal>, _scp::FftSizesLess> cache;
+		return cache;
+	}
+}
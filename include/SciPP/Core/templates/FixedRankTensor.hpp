@@ -0,0 +1,185 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//! \file
+//! \author Plgrin Marius
+//! \copyright The MIT License (MIT)
+//! \date 2019-2024
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <SciPP/Core/CoreDecl.hpp>
+
+namespace scp
+{
+	template<typename TValue, uint64_t Rank>
+	constexpr FixedRankTensor<TValue, Rank>::FixedRankTensor(const uint64_t* sizes) : Tensor<TValue>(Rank, sizes)
+	{
+	}
+
+	template<typename TValue, uint64_t Rank>
+	constexpr FixedRankTensor<TValue, Rank>::FixedRankTensor(const uint64_t* sizes, const TValue& value) : Tensor<TValue>(Rank, sizes, value)
+	{
+	}
+
+	template<typename TValue, uint64_t Rank>
+	constexpr FixedRankTensor<TValue, Rank>::FixedRankTensor(const uint64_t* sizes, const TValue* values) : Tensor<TValue>(Rank, sizes, values)
+	{
+	}
+
+	template<typename TValue, uint64_t Rank>
+	constexpr FixedRankTensor<TValue, Rank>::FixedRankTensor(const std::initializer_list<uint64_t>& sizes) : Tensor<TValue>(sizes)
+	{
+		assert(sizes.size() == Rank);
+	}
+
+	template<typename TValue, uint64_t Rank>
+	constexpr FixedRankTensor<TValue, Rank>::FixedRankTensor(const std::initializer_list<uint64_t>& sizes, const TValue& value) : Tensor<TValue>(sizes, value)
+	{
+		assert(sizes.size() == Rank);
+	}
+
+	template<typename TValue, uint64_t Rank>
+	constexpr FixedRankTensor<TValue, Rank>::FixedRankTensor(const std::initializer_list<uint64_t>& sizes, const TValue* values) : Tensor<TValue>(sizes, values)
+	{
+		assert(sizes.size() == Rank);
+	}
+
+	template<typename TValue, uint64_t Rank>
+	constexpr FixedRankTensor<TValue, Rank>::FixedRankTensor(const std::initializer_list<uint64_t>& sizes, const std::initializer_list<TValue>& values) : Tensor<TValue>(sizes, values)
+	{
+		assert(sizes.size() == Rank);
+	}
+
+	template<typename TValue, uint64_t Rank>
+	constexpr FixedRankTensor<TValue, Rank>::FixedRankTensor(const Tensor<TValue>& tensor) : Tensor<TValue>(tensor)
+	{
+		assert(_shape.order == Rank);
+	}
+
+	template<typename TValue, uint64_t Rank>
+	template<CTensorExpr TExpr>
+	constexpr FixedRankTensor<TValue, Rank>::FixedRankTensor(const TExpr& expr) : Tensor<TValue>(expr)
+	{
+		assert(_shape.order == Rank);
+	}
+
+	template<typename TValue, uint64_t Rank>
+	constexpr FixedRankTensor<TValue, Rank>& FixedRankTensor<TValue, Rank>::operator=(const Tensor<TValue>& tensor)
+	{
+		assert(tensor.getOrder() == Rank);
+
+		Tensor<TValue>::operator=(tensor);
+
+		return *this;
+	}
+
+	template<typename TValue, uint64_t Rank>
+	template<CTensorExpr TExpr>
+	constexpr FixedRankTensor<TValue, Rank>& FixedRankTensor<TValue, Rank>::operator=(const TExpr& expr)
+	{
+		assert(expr.getShape().order == Rank);
+
+		Tensor<TValue>::operator=(expr);
+
+		return *this;
+	}
+
+	template<typename TValue, uint64_t Rank>
+	constexpr TValue& FixedRankTensor<TValue, Rank>::operator[](const std::initializer_list<uint64_t>& indices)
+	{
+		return get(indices);
+	}
+
+	template<typename TValue, uint64_t Rank>
+	constexpr const TValue& FixedRankTensor<TValue, Rank>::operator[](const std::initializer_list<uint64_t>& indices) const
+	{
+		return get(indices);
+	}
+
+	template<typename TValue, uint64_t Rank>
+	constexpr const TValue& FixedRankTensor<TValue, Rank>::get(const uint64_t* indices) const
+	{
+		return _values[getIndex(indices)];
+	}
+
+	template<typename TValue, uint64_t Rank>
+	constexpr const TValue& FixedRankTensor<TValue, Rank>::get(const std::initializer_list<uint64_t>& indices) const
+	{
+		assert(indices.size() == Rank);
+		return _values[getIndex(indices.begin())];
+	}
+
+	template<typename TValue, uint64_t Rank>
+	constexpr TValue& FixedRankTensor<TValue, Rank>::get(const uint64_t* indices)
+	{
+		_detachValues();
+		return _values[getIndex(indices)];
+	}
+
+	template<typename TValue, uint64_t Rank>
+	constexpr TValue& FixedRankTensor<TValue, Rank>::get(const std::initializer_list<uint64_t>& indices)
+	{
+		assert(indices.size() == Rank);
+		_detachValues();
+		return _values[getIndex(indices.begin())];
+	}
+
+	template<typename TValue, uint64_t Rank>
+	constexpr void FixedRankTensor<TValue, Rank>::set(const uint64_t* indices, const TValue& value)
+	{
+		_detachValues();
+		_values[getIndex(indices)] = value;
+	}
+
+	template<typename TValue, uint64_t Rank>
+	constexpr void FixedRankTensor<TValue, Rank>::set(const std::initializer_list<uint64_t>& indices, const TValue& value)
+	{
+		assert(indices.size() == Rank);
+		_detachValues();
+		_values[getIndex(indices.begin())] = value;
+	}
+
+	template<typename TValue, uint64_t Rank>
+	constexpr uint64_t FixedRankTensor<TValue, Rank>::getIndex(const uint64_t* indices) const
+	{
+		assert(_shape.order == Rank);
+
+		return [&]<uint64_t... Axes>(std::index_sequence<Axes...>)
+		{
+			assert(((indices[Axes] < _shape.sizes[Axes]) && ...));
+
+			uint64_t index = 0;
+			((index = index * _shape.sizes[Axes] + indices[Axes]), ...);
+			return index;
+		}(std::make_index_sequence<Rank>());
+	}
+
+	template<typename TValue, uint64_t Rank>
+	constexpr void FixedRankTensor<TValue, Rank>::getIndices(uint64_t index, uint64_t* indices) const
+	{
+		assert(_shape.order == Rank);
+		assert(index < _length);
+
+		[&]<uint64_t... Axes>(std::index_sequence<Axes...>)
+		{
+			((indices[Rank - 1 - Axes] = index % _shape.sizes[Rank - 1 - Axes], index /= _shape.sizes[Rank - 1 - Axes]), ...);
+		}(std::make_index_sequence<Rank>());
+	}
+
+	template<typename TValue, uint64_t Rank>
+	constexpr std::array<uint64_t, Rank> FixedRankTensor<TValue, Rank>::getStrides() const
+	{
+		assert(_shape.order == Rank);
+
+		std::array<uint64_t, Rank> strides;
+
+		uint64_t stride = 1;
+		for (uint64_t i = Rank; i-- > 0;)
+		{
+			strides[i] = stride;
+			stride *= _shape.sizes[i];
+		}
+
+		return strides;
+	}
+}
@@ -0,0 +1,236 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//! \file
+//! \author Plgrin Marius
+//! \copyright The MIT License (MIT)
+//! \date 2019-2024
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <SciPP/Core/CoreDecl.hpp>
+
+namespace scp
+{
+	namespace _scp
+	{
+		template<typename TValue>
+		constexpr void gemm(uint64_t m, uint64_t n, uint64_t k, const TValue* a, uint64_t lda, const TValue* b, uint64_t ldb, TValue* c, uint64_t ldc)
+		{
+			if constexpr (CSimdReal<TValue>)
+			{
+				if !consteval
+				{
+					// Below a few tiles, packing costs more than it saves
+
+					const SimdGemmKernel<TValue> kernel = getSimdGemmKernel<TValue>();
+					if (kernel.func && m >= kernel.rows && n >= kernel.cols && m * n * k >= 32768)
+					{
+						gemmPacked(m, n, k, a, lda, b, ldb, c, ldc, kernel);
+						return;
+					}
+				}
+			}
+
+			if (m == 1)
+			{
+				parallelFor(n, 2 * k, [&](uint64_t begin, uint64_t end)
+				{
+					gemmUnpacked(1, end - begin, k, a, lda, b + begin, ldb, c + begin, ldc);
+				});
+			}
+			else
+			{
+				parallelFor(m, 2 * n * k, [&](uint64_t begin, uint64_t end)
+				{
+					gemmUnpacked(end - begin, n, k, a + begin * lda, lda, b, ldb, c + begin * ldc, ldc);
+				});
+			}
+		}
+
+		template<typename TValue>
+		constexpr void gemmUnpacked(uint64_t m, uint64_t n, uint64_t k, const TValue* a, uint64_t lda, const TValue* b, uint64_t ldb, TValue* c, uint64_t ldc)
+		{
+			if constexpr (CSimdReal<TValue>)
+			{
+				if !consteval
+				{
+					if (n == 1 && ldb == 1)
+					{
+						for (uint64_t i = 0; i < m; ++i)
+						{
+							c[i * ldc] += simdDot(a + i * lda, b, k);
+						}
+
+						return;
+					}
+
+					for (uint64_t i = 0; i < m; ++i)
+					{
+						for (uint64_t p = 0; p < k; ++p)
+						{
+							simdMultiplyAdd(c + i * ldc, b + p * ldb, a[i * lda + p], n);
+						}
+					}
+
+					return;
+				}
+			}
+
+			for (uint64_t i = 0; i < m; ++i)
+			{
+				TValue* cRow = c + i * ldc;
+
+				for (uint64_t p = 0; p < k; ++p)
+				{
+					const TValue& x = a[i * lda + p];
+					const TValue* bRow = b + p * ldb;
+
+					for (uint64_t j = 0; j < n; ++j)
+					{
+						cRow[j] += x * bRow[j];
+					}
+				}
+			}
+		}
+
+		template<CSimdReal TValue>
+		void gemmPackA(uint64_t rows, uint64_t depth, const TValue* a, uint64_t lda, uint64_t panelRows, TValue* packed)
+		{
+			for (uint64_t i = 0; i < rows; i += panelRows)
+			{
+				const uint64_t count = std::min(panelRows, rows - i);
+
+				for (uint64_t p = 0; p < depth; ++p, packed += panelRows)
+				{
+					for (uint64_t r = 0; r < count; ++r)
+					{
+						packed[r] = a[(i + r) * lda + p];
+					}
+
+					std::fill(packed + count, packed + panelRows, TValue(0));
+				}
+			}
+		}
+
+		template<CSimdReal TValue>
+		void gemmPackB(uint64_t depth, uint64_t cols, const TValue* b, uint64_t ldb, uint64_t panelCols, TValue* packed)
+		{
+			for (uint64_t j = 0; j < cols; j += panelCols)
+			{
+				const uint64_t count = std::min(panelCols, cols - j);
+
+				for (uint64_t p = 0; p < depth; ++p, packed += panelCols)
+				{
+					std::copy_n(b + p * ldb + j, count, packed);
+					std::fill(packed + count, packed + panelCols, TValue(0));
+				}
+			}
+		}
+
+		template<CSimdReal TValue>
+		void gemmBlock(uint64_t rows, uint64_t cols, uint64_t depth, const TValue* packedA, const TValue* packedB, TValue* c, uint64_t ldc, const SimdGemmKernel<TValue>& kernel, TValue* tile)
+		{
+			for (uint64_t jr = 0; jr < cols; jr += kernel.cols)
+			{
+				const uint64_t tileCols = std::min(kernel.cols, cols - jr);
+				const TValue* panelB = packedB + jr * depth;
+
+				for (uint64_t ir = 0; ir < rows; ir += kernel.rows)
+				{
+					const uint64_t tileRows = std::min(kernel.rows, rows - ir);
+					const TValue* panelA = packedA + ir * depth;
+					TValue* tileC = c + ir * ldc + jr;
+
+					if (tileRows == kernel.rows && tileCols == kernel.cols)
+					{
+						kernel.func(depth, panelA, panelB, tileC, ldc);
+					}
+					else
+					{
+						std::fill_n(tile, kernel.rows * kernel.cols, TValue(0));
+						kernel.func(depth, panelA, panelB, tile, kernel.cols);
+
+						for (uint64_t r = 0; r < tileRows; ++r)
+						{
+							for (uint64_t j = 0; j < tileCols; ++j)
+							{
+								tileC[r * ldc + j] += tile[r * kernel.cols + j];
+							}
+						}
+					}
+				}
+			}
+		}
+
+		template<CSimdReal TValue>
+		void gemmPacked(uint64_t m, uint64_t n, uint64_t k, const TValue* a, uint64_t lda, const TValue* b, uint64_t ldb, TValue* c, uint64_t ldc, const SimdGemmKernel<TValue>& kernel)
+		{
+			// The depth kc amortizes the loads and stores of each tile of c while keeping the slice of the b panel read by
+			// the kernel in L1, then a block of a fills half of the L2 and a panel of b half of the L3
+
+			constexpr uint64_t l2Size = 256 * 1024;
+			constexpr uint64_t l3Size = 4 * 1024 * 1024;
+
+			const uint64_t kc = std::min<uint64_t>(k, 256);
+			const uint64_t mc = std::max<uint64_t>(l2Size / (2 * kc * sizeof(TValue)) / kernel.rows, 1) * kernel.rows;
+			const uint64_t nc = std::max<uint64_t>(l3Size / (2 * kc * sizeof(TValue)) / kernel.cols, 1) * kernel.cols;
+
+			const uint64_t rowPanels = (m + kernel.rows - 1) / kernel.rows;
+			const uint64_t mPacked = std::min(mc, rowPanels * kernel.rows);
+			const uint64_t nPacked = std::min(nc, (n + kernel.cols - 1) / kernel.cols * kernel.cols);
+
+			ScratchBuffer<TValue> packedB(kc * nPacked);
+
+			for (uint64_t jc = 0; jc < n; jc += nc)
+			{
+				const uint64_t nb = std::min(nc, n - jc);
+				const uint64_t colPanels = (nb + kernel.cols - 1) / kernel.cols;
+
+				for (uint64_t pc = 0; pc < k; pc += kc)
+				{
+					const uint64_t kb = std::min(kc, k - pc);
+
+					parallelFor(colPanels, kb * kernel.cols, [&](uint64_t begin, uint64_t end)
+					{
+						const uint64_t colBegin = begin * kernel.cols;
+						const uint64_t colEnd = std::min(end * kernel.cols, nb);
+
+						gemmPackB(kb, colEnd - colBegin, b + pc * ldb + jc + colBegin, ldb, kernel.cols, packedB.getData() + colBegin * kb);
+					});
+
+					const auto computeBlock = [&](uint64_t rowBegin, uint64_t rowEnd, uint64_t colBegin, uint64_t colEnd)
+					{
+						ScratchBuffer<TValue> packedA(kc * mPacked);
+						ScratchBuffer<TValue> tile(kernel.rows * kernel.cols);
+
+						for (uint64_t ic = rowBegin; ic < rowEnd; ic += mc)
+						{
+							const uint64_t mb = std::min(mc, rowEnd - ic);
+
+							gemmPackA(mb, kb, a + ic * lda + pc, lda, kernel.rows, packedA.getData());
+							gemmBlock(mb, colEnd - colBegin, kb, packedA.getData(), packedB.getData() + colBegin * kb, c + ic * ldc + jc + colBegin, ldc, kernel, tile.getData());
+						}
+					};
+
+					// Splitting the rows shares the packed panel of b between the tasks, splitting the columns makes each
+					// of them pack all of a, which is only worth it when a has too few rows to keep every task busy
+
+					if (rowPanels >= std::min(exec.concurrency, colPanels))
+					{
+						parallelFor(rowPanels, 2 * kernel.rows * nb * kb, [&](uint64_t begin, uint64_t end)
+						{
+							computeBlock(begin * kernel.rows, std::min(end * kernel.rows, m), 0, nb);
+						});
+					}
+					else
+					{
+						parallelFor(colPanels, 2 * m * kernel.cols * kb, [&](uint64_t begin, uint64_t end)
+						{
+							computeBlock(0, m, begin * kernel.cols, std::min(end * kernel.cols, nb));
+						});
+					}
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,292 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//! \file
+//! \author Plgrin Marius
+//! \copyright The MIT License (MIT)
+//! \date 2019-2024
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <SciPP/Core/CoreDecl.hpp>
+
+namespace scp
+{
+	template<typename TValue>
+	constexpr HaloTensor<TValue>::HaloTensor(uint64_t order, const uint64_t* sizes, const uint64_t* halos) :
+		_tensor(order, _getPaddedSizes(order, sizes, halos).data()),
+		_sizes(sizes, sizes + order),
+		_halos(halos, halos + order),
+		_strides(order),
+		_origin(0)
+	{
+		_computeStrides();
+	}
+
+	template<typename TValue>
+	constexpr HaloTensor<TValue>::HaloTensor(uint64_t order, const uint64_t* sizes, const uint64_t* halos, const TValue& value) :
+		_tensor(order, _getPaddedSizes(order, sizes, halos).data(), value),
+		_sizes(sizes, sizes + order),
+		_halos(halos, halos + order),
+		_strides(order),
+		_origin(0)
+	{
+		_computeStrides();
+	}
+
+	template<typename TValue>
+	constexpr HaloTensor<TValue>::HaloTensor(const std::initializer_list<uint64_t>& sizes, const std::initializer_list<uint64_t>& halos) : HaloTensor<TValue>(sizes.size(), sizes.begin(), halos.begin())
+	{
+		assert(sizes.size() == halos.size());
+	}
+
+	template<typename TValue>
+	constexpr HaloTensor<TValue>::HaloTensor(const std::initializer_list<uint64_t>& sizes, const std::initializer_list<uint64_t>& halos, const TValue& value) : HaloTensor<TValue>(sizes.size(), sizes.begin(), halos.begin(), value)
+	{
+		assert(sizes.size() == halos.size());
+	}
+
+	template<typename TValue>
+	constexpr HaloTensor<TValue>::HaloTensor(const Tensor<TValue>& tensor, const uint64_t* halos) : HaloTensor<TValue>(tensor.getOrder(), tensor.getSizes(), halos)
+	{
+		getInterior() = tensor;
+	}
+
+	template<typename TValue>
+	constexpr HaloTensor<TValue>::HaloTensor(const Tensor<TValue>& tensor, const std::initializer_list<uint64_t>& halos) : HaloTensor<TValue>(tensor, halos.begin())
+	{
+		assert(tensor.getOrder() == halos.size());
+	}
+
+	template<typename TValue>
+	template<CTensorOperand TOperand>
+	constexpr HaloTensor<TValue>& HaloTensor<TValue>::operator=(const TOperand& operand)
+	{
+		getInterior() = operand;
+		return *this;
+	}
+
+	template<typename TValue>
+	template<BorderBehaviour BBehaviour>
+	constexpr void HaloTensor<TValue>::fillHalo()
+	{
+		const uint64_t order = _sizes.size();
+		const uint64_t* paddedSizes = _tensor.getSizes();
+		TValue* data = _tensor.getData();
+
+		// Along axis i, each layer of ghost cells is a slab of contiguous elements for each index of the previous axes.
+		// The slabs span the ghost cells of the other axes too, those of the previous axes being already filled.
+
+		uint64_t outerCount = 1;
+		for (uint64_t i = 0; i < order; ++i)
+		{
+			const uint64_t size = _sizes[i];
+			const uint64_t halo = _halos[i];
+			const uint64_t innerCount = static_cast<uint64_t>(_strides[i]);
+			const uint64_t slabSize = paddedSizes[i] * innerCount;
+
+			assert(BBehaviour != BorderBehaviour::Periodic || halo <= size);
+
+			if (halo != 0)
+			{
+				_scp::parallelFor(outerCount, 2 * halo * innerCount, [&](uint64_t begin, uint64_t end)
+				{
+					for (uint64_t j = begin; j < end; ++j)
+					{
+						TValue* slab = data + j * slabSize;
+
+						for (uint64_t k = 0; k < halo; ++k)
+						{
+							TValue* lowLayer = slab + (halo - 1 - k) * innerCount;
+							TValue* highLayer = slab + (halo + size + k) * innerCount;
+
+							if constexpr (BBehaviour == BorderBehaviour::Zero)
+							{
+								std::fill_n(lowLayer, innerCount, TValue(0));
+								std::fill_n(highLayer, innerCount, TValue(0));
+							}
+							else if constexpr (BBehaviour == BorderBehaviour::Continuous)
+							{
+								std::copy_n(slab + halo * innerCount, innerCount, lowLayer);
+								std::copy_n(slab + (halo + size - 1) * innerCount, innerCount, highLayer);
+							}
+							else if constexpr (BBehaviour == BorderBehaviour::Periodic)
+							{
+								std::copy_n(slab + (halo + size - 1 - k) * innerCount, innerCount, lowLayer);
+								std::copy_n(slab + (halo + k) * innerCount, innerCount, highLayer);
+							}
+						}
+					}
+				});
+			}
+
+			outerCount *= paddedSizes[i];
+		}
+	}
+
+	template<typename TValue>
+	constexpr TensorView<TValue> HaloTensor<TValue>::getInterior()
+	{
+		return TensorView<TValue>(_tensor).block(_halos.data(), _sizes.data());
+	}
+
+	template<typename TValue>
+	constexpr TensorView<const TValue> HaloTensor<TValue>::getInterior() const
+	{
+		return TensorView<const TValue>(_tensor).block(_halos.data(), _sizes.data());
+	}
+
+	template<typename TValue>
+	constexpr Tensor<TValue>& HaloTensor<TValue>::getPadded()
+	{
+		return _tensor;
+	}
+
+	template<typename TValue>
+	constexpr const Tensor<TValue>& HaloTensor<TValue>::getPadded() const
+	{
+		return _tensor;
+	}
+
+	template<typename TValue>
+	constexpr TValue& HaloTensor<TValue>::operator[](const std::initializer_list<int64_t>& indices)
+	{
+		return get(indices);
+	}
+
+	template<typename TValue>
+	constexpr const TValue& HaloTensor<TValue>::operator[](const std::initializer_list<int64_t>& indices) const
+	{
+		return get(indices);
+	}
+
+	template<typename TValue>
+	constexpr TValue& HaloTensor<TValue>::get(const int64_t* indices)
+	{
+		return _tensor.getData()[_getOffset(indices)];
+	}
+
+	template<typename TValue>
+	constexpr const TValue& HaloTensor<TValue>::get(const int64_t* indices) const
+	{
+		return _tensor.getData()[_getOffset(indices)];
+	}
+
+	template<typename TValue>
+	constexpr TValue& HaloTensor<TValue>::get(const std::initializer_list<int64_t>& indices)
+	{
+		assert(indices.size() == _sizes.size());
+		return get(indices.begin());
+	}
+
+	template<typename TValue>
+	constexpr const TValue& HaloTensor<TValue>::get(const std::initializer_list<int64_t>& indices) const
+	{
+		assert(indices.size() == _sizes.size());
+		return get(indices.begin());
+	}
+
+	template<typename TValue>
+	constexpr uint64_t HaloTensor<TValue>::getOrder() const
+	{
+		return _sizes.size();
+	}
+
+	template<typename TValue>
+	constexpr const uint64_t* HaloTensor<TValue>::getSizes() const
+	{
+		return _sizes.data();
+	}
+
+	template<typename TValue>
+	constexpr uint64_t HaloTensor<TValue>::getSize(uint64_t i) const
+	{
+		assert(i < _sizes.size());
+		return _sizes[i];
+	}
+
+	template<typename TValue>
+	constexpr const uint64_t* HaloTensor<TValue>::getHalos() const
+	{
+		return _halos.data();
+	}
+
+	template<typename TValue>
+	constexpr uint64_t HaloTensor<TValue>::getHalo(uint64_t i) const
+	{
+		assert(i < _halos.size());
+		return _halos[i];
+	}
+
+	template<typename TValue>
+	constexpr const int64_t* HaloTensor<TValue>::getStrides() const
+	{
+		return _strides.data();
+	}
+
+	template<typename TValue>
+	constexpr int64_t HaloTensor<TValue>::getStride(uint64_t i) const
+	{
+		assert(i < _strides.size());
+		return _strides[i];
+	}
+
+	template<typename TValue>
+	constexpr uint64_t HaloTensor<TValue>::getElementCount() const
+	{
+		return std::accumulate(_sizes.begin(), _sizes.end(), uint64_t(1), std::multiplies<uint64_t>());
+	}
+
+	template<typename TValue>
+	constexpr TValue* HaloTensor<TValue>::getData()
+	{
+		return _tensor.getData() + _origin;
+	}
+
+	template<typename TValue>
+	constexpr const TValue* HaloTensor<TValue>::getData() const
+	{
+		return _tensor.getData() + _origin;
+	}
+
+	template<typename TValue>
+	constexpr std::vector<uint64_t> HaloTensor<TValue>::_getPaddedSizes(uint64_t order, const uint64_t* sizes, const uint64_t* halos)
+	{
+		assert(order != 0);
+
+		std::vector<uint64_t> paddedSizes(order);
+		for (uint64_t i = 0; i < order; ++i)
+		{
+			paddedSizes[i] = sizes[i] + 2 * halos[i];
+		}
+
+		return paddedSizes;
+	}
+
+	template<typename TValue>
+	constexpr void HaloTensor<TValue>::_computeStrides()
+	{
+		const uint64_t* paddedSizes = _tensor.getSizes();
+
+		int64_t stride = 1;
+		_origin = 0;
+		for (uint64_t i = _sizes.size(); i-- > 0;)
+		{
+			_strides[i] = stride;
+			_origin += static_cast<int64_t>(_halos[i]) * stride;
+			stride *= static_cast<int64_t>(paddedSizes[i]);
+		}
+	}
+
+	template<typename TValue>
+	constexpr int64_t HaloTensor<TValue>::_getOffset(const int64_t* indices) const
+	{
+		int64_t offset = _origin;
+		for (uint64_t i = 0; i < _sizes.size(); ++i)
+		{
+			assert(indices[i] >= -static_cast<int64_t>(_halos[i]) && indices[i] < static_cast<int64_t>(_sizes[i] + _halos[i]));
+			offset += indices[i] * _strides[i];
+		}
+
+		return offset;
+	}
+}
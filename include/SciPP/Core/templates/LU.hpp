@@ -0,0 +1,254 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//! \file
+//! \author Plgrin Marius
+//! \copyright The MIT License (MIT)
+//! \date 2019-2024
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <SciPP/Core/CoreDecl.hpp>
+
+namespace scp
+{
+	namespace _scp
+	{
+		template<typename TValue>
+		constexpr LUStatus luFactorize(uint64_t size, TValue* values, uint64_t* pivots)
+		{
+			LUStatus status = { false, false };
+
+			for (uint64_t begin = 0; begin < size; begin += luBlockSize)
+			{
+				const uint64_t end = std::min(begin + luBlockSize, size);
+
+				luFactorizePanel(size, values, pivots, begin, end, status);
+
+				if (end == size)
+				{
+					break;
+				}
+
+				// The rows of the panel right of it become U12 by forward substitution with L11, then the trailing matrix
+				// loses L21.U12
+
+				for (uint64_t i = begin + 1; i < end; ++i)
+				{
+					for (uint64_t p = begin; p < i; ++p)
+					{
+						multiplyAdd(values + i * size + end, values + p * size + end, -values[i * size + p], size - end);
+					}
+				}
+
+				luSubtractProduct(size - end, size - end, end - begin, values + end * size + begin, size, values + begin * size + end, size, values + end * size + end, size);
+			}
+
+			return status;
+		}
+
+		template<typename TValue>
+		constexpr void luSolve(uint64_t size, const TValue* factors, const uint64_t* pivots, TValue* x, uint64_t count)
+		{
+			for (uint64_t i = 0; i < size; ++i)
+			{
+				if (pivots[i] != i)
+				{
+					std::swap_ranges(x + i * count, x + (i + 1) * count, x + pivots[i] * count);
+				}
+			}
+
+			// Both substitutions go by blocks of rows: the contribution of the rows already solved is removed with a
+			// matrix product, then the block is solved row by row
+
+			for (uint64_t begin = 0; begin < size; begin += luBlockSize)
+			{
+				const uint64_t end = std::min(begin + luBlockSize, size);
+
+				luSubtractProduct(end - begin, count, begin, factors + begin * size, size, x, count, x + begin * count, count);
+
+				for (uint64_t i = begin + 1; i < end; ++i)
+				{
+					for (uint64_t p = begin; p < i; ++p)
+					{
+						multiplyAdd(x + i * count, x + p * count, -factors[i * size + p], count);
+					}
+				}
+			}
+
+			for (uint64_t end = size; end != 0;)
+			{
+				const uint64_t begin = (end - 1) / luBlockSize * luBlockSize;
+
+				luSubtractProduct(end - begin, count, size - end, factors + begin * size + end, size, x + end * count, count, x + begin * count, count);
+
+				for (uint64_t i = end - 1; i != begin - 1; --i)
+				{
+					for (uint64_t p = i + 1; p < end; ++p)
+					{
+						multiplyAdd(x + i * count, x + p * count, -factors[i * size + p], count);
+					}
+
+					const TValue& diagonal = factors[i * size + i];
+					for (uint64_t j = 0; j < count; ++j)
+					{
+						x[i * count + j] /= diagonal;
+					}
+				}
+
+				end = begin;
+			}
+		}
+
+		template<typename TValue>
+		constexpr TValue luDeterminant(uint64_t size, const TValue* factors, const LUStatus& status)
+		{
+			TValue det = status.oddPermutation ? TValue(-1) : TValue(1);
+			for (uint64_t i = 0; i < size; ++i)
+			{
+				det *= factors[i * size + i];
+			}
+
+			return det;
+		}
+
+		template<typename TValue>
+		constexpr void luFactorizePanel(uint64_t size, TValue* values, uint64_t* pivots, uint64_t begin, uint64_t end, LUStatus& status)
+		{
+			for (uint64_t j = begin; j < end; ++j)
+			{
+				uint64_t pivot = j;
+				if constexpr (HasStdAbs<TValue>)
+				{
+					for (uint64_t i = j + 1; i < size; ++i)
+					{
+						if (std::abs(values[pivot * size + j]) < std::abs(values[i * size + j]))
+						{
+							pivot = i;
+						}
+					}
+				}
+				else
+				{
+					while (pivot + 1 < size && values[pivot * size + j] == TValue(0))
+					{
+						++pivot;
+					}
+				}
+
+				// Whole rows are swapped, so that the permutation also applies to the columns left and right of the panel
+
+				pivots[j] = pivot;
+				if (pivot != j)
+				{
+					std::swap_ranges(values + j * size, values + (j + 1) * size, values + pivot * size);
+					status.oddPermutation = !status.oddPermutation;
+				}
+
+				const TValue diagonal = values[j * size + j];
+				if (diagonal == TValue(0))
+				{
+					status.singular = true;
+					continue;
+				}
+
+				for (uint64_t i = j + 1; i < size; ++i)
+				{
+					TValue* row = values + i * size;
+
+					row[j] /= diagonal;
+					if (row[j] != TValue(0))
+					{
+						multiplyAdd(row + j + 1, values + j * size + j + 1, -row[j], end - j - 1);
+					}
+				}
+			}
+		}
+
+		template<typename TValue>
+		constexpr void luSubtractProduct(uint64_t m, uint64_t n, uint64_t k, const TValue* a, uint64_t lda, const TValue* b, uint64_t ldb, TValue* c, uint64_t ldc)
+		{
+			if (m == 0 || n == 0 || k == 0)
+			{
+				return;
+			}
+
+			ScratchBuffer<TValue> negated(m * k);
+			for (uint64_t i = 0; i < m; ++i)
+			{
+				for (uint64_t p = 0; p < k; ++p)
+				{
+					negated[i * k + p] = -a[i * lda + p];
+				}
+			}
+
+			gemm(m, n, k, negated.getData(), k, b, ldb, c, ldc);
+		}
+	}
+
+	template<typename TValue>
+	constexpr LU<TValue>::LU(const Matrix<TValue>& matrix) :
+		_factors(matrix),
+		_pivots(matrix.getSize(0)),
+		_status()
+	{
+		assert(matrix.getSize(0) == matrix.getSize(1));
+
+		_status = _scp::luFactorize(_factors.getSize(0), _factors.getData(), _pivots.data());
+	}
+
+	template<typename TValue>
+	constexpr void LU<TValue>::solve(Vector<TValue>& b) const
+	{
+		assert(b.getSize(0) == _factors.getSize(0));
+
+		if (_status.singular)
+		{
+			throw std::runtime_error("The matrix is singular.");
+		}
+
+		_scp::luSolve(_factors.getSize(0), _factors.getData(), _pivots.data(), b.getData(), 1);
+	}
+
+	template<typename TValue>
+	constexpr void LU<TValue>::solve(Matrix<TValue>& B) const
+	{
+		assert(B.getSize(0) == _factors.getSize(0));
+
+		if (_status.singular)
+		{
+			throw std::runtime_error("The matrix is singular.");
+		}
+
+		_scp::luSolve(_factors.getSize(0), _factors.getData(), _pivots.data(), B.getData(), B.getSize(1));
+	}
+
+	template<typename TValue>
+	constexpr TValue LU<TValue>::determinant() const
+	{
+		return _scp::luDeterminant(_factors.getSize(0), _factors.getData(), _status);
+	}
+
+	template<typename TValue>
+	constexpr bool LU<TValue>::isSingular() const
+	{
+		return _status.singular;
+	}
+
+	template<typename TValue>
+	constexpr const Matrix<TValue>& LU<TValue>::getFactors() const
+	{
+		return _factors;
+	}
+
+	template<typename TValue>
+	constexpr const uint64_t* LU<TValue>::getPivots() const
+	{
+		return _pivots.data();
+	}
+
+	template<typename TValue>
+	constexpr uint64_t LU<TValue>::getSize() const
+	{
+		return _factors.getSize(0);
+	}
+}
@@ -61,6 +61,24 @@ namespace scp
 	{
 	}
 
+	template<typename TValue>
+	template<CTensorExpr TExpr>
+	constexpr Matrix<TValue>::Matrix(const TExpr& expr) : Tensor<TValue>(expr)
+	{
+		assert(_shape.order == 2);
+	}
+
+	template<typename TValue>
+	template<CTensorExpr TExpr>
+	constexpr Matrix<TValue>& Matrix<TValue>::operator=(const TExpr& expr)
+	{
+		assert(expr.getShape().order == 2);
+
+		Tensor<TValue>::operator=(expr);
+
+		return *this;
+	}
+
 	template<typename TValue>
 	constexpr void Matrix<TValue>::matrixProduct(const Tensor<TValue>& matrixA, const Tensor<TValue>& matrixB)
 	{
@@ -70,35 +88,19 @@ namespace scp
 		assert(matrixA._shape.sizes[0] == _shape.sizes[0]);
 		assert(matrixB._shape.sizes[1] == _shape.sizes[1]);
 
-		const uint64_t& size = matrixB._shape.sizes[0];
-
-		TValue* values = _values;
-		const TValue* valuesA = matrixA._values;
-		const TValue* valuesB = matrixB._values;
-
-		for (uint64_t i = 0; i < _shape.sizes[0]; ++i)
-		{
-			for (uint64_t j = 0; j < _shape.sizes[1]; ++j, ++values)
-			{
-				*values = 0;
-
-				for (uint64_t k = 0; k < size; ++k, ++valuesA, valuesB += _shape.sizes[1])
-				{
-					*values += (*valuesA) * (*valuesB);
-				}
+		_detachValues();
 
-				valuesA -= size;
-				valuesB -= matrixB._length - 1;
-			}
+		const uint64_t& size = matrixB._shape.sizes[0];
 
-			valuesA += size;
-			valuesB -= _shape.sizes[1];
-		}
+		std::fill_n(_values, _length, _zero);
+		_scp::gemm(_shape.sizes[0], _shape.sizes[1], size, matrixA._values, size, matrixB._values, _shape.sizes[1], _values, _shape.sizes[1]);
 	}
 
 	template<typename TValue>
 	constexpr void Matrix<TValue>::transpose()
 	{
+		_detachValues();
+
 		if (_shape.sizes[0] == _shape.sizes[1])
 		{
 			const uint64_t& size = _shape.sizes[0];
@@ -166,99 +168,25 @@ namespace scp
 	{
 		assert(_shape.sizes[0] == _shape.sizes[1]);
 
-		const uint64_t size = _shape.sizes[0];
-		Matrix<TValue> copy(*this);
-
-		TValue* it = nullptr;
-		TValue* copyIt = nullptr;
-		TValue* otherIt = nullptr;
-		TValue* copyOtherIt = nullptr;
-		const TValue* itEnd = nullptr;
-		const TValue* copyItEnd = nullptr;
-		const TValue* otherItEnd = nullptr;
-		const TValue* copyOtherItEnd = nullptr;
+		_detachValues();
 
-		std::fill_n(_values, _length, _zero);
+		const uint64_t size = _shape.sizes[0];
+		_scp::ScratchBuffer<TValue> factors(_length);
+		_scp::ScratchBuffer<uint64_t> pivots(size);
+		std::copy_n(_values, _length, factors.getData());
 
-		it = _values;
-		itEnd = it + _length + size;
-		for (; it != itEnd; it += size + 1)
+		if (_scp::luFactorize(size, factors.getData(), pivots.getData()).singular)
 		{
-			*it = _one;
+			throw std::runtime_error("The matrix cannot be inverted.");
 		}
 
-		it = _values;
-		itEnd = it + size;
-		copyIt = copy._values;
-		copyItEnd = copyIt + size;
-		for (uint64_t j = 0; j < size; ++j, it += size + 1, itEnd += size, copyIt += size + 1, copyItEnd += size)
+		std::fill_n(_values, _length, _zero);
+		for (uint64_t i = 0; i < size; ++i)
 		{
-			const TValue pivot = *copyIt;
-
-			if (pivot == _zero)
-			{
-				otherIt = it + size;
-				otherItEnd = itEnd + size;
-				copyOtherIt = copyIt + size;
-				copyOtherItEnd = copyItEnd + size;
-				for (uint64_t i = j + 1; i < size; ++i, otherIt += size, otherItEnd += size, copyOtherIt += size, copyOtherItEnd += size)
-				{
-					const TValue value = *copyOtherIt;
-					if (value != _zero)
-					{
-						std::transform<const TValue*>(it, itEnd, otherIt, it, [&](const TValue& x, const TValue& y) { return x + y / value; });
-						std::transform<const TValue*>(copyIt, copyItEnd, copyOtherIt, copyIt, [&](const TValue& x, const TValue& y) { return x + y / value; });
-
-						break;
-					}
-				}
-
-				if (*copyIt == _zero)
-				{
-					throw std::runtime_error("The matrix cannot be inverted.");
-				}
-			}
-			else if (pivot != _one)
-			{
-				std::transform<const TValue*>(it, itEnd, it, [&](const TValue& x) { return x / pivot; });
-				std::transform<const TValue*>(copyIt, copyItEnd, copyIt, [&](const TValue& x) { return x / pivot; });
-			}
-
-			otherIt = it + size;
-			otherItEnd = itEnd + size;
-			copyOtherIt = copyIt + size;
-			copyOtherItEnd = copyItEnd + size;
-			for (uint64_t i = j + 1; i < size; ++i, otherIt += size, otherItEnd += size, copyOtherIt += size, copyOtherItEnd += size)
-			{
-				const TValue value = *copyOtherIt;
-				if (value != _zero)
-				{
-					std::transform<const TValue*>(otherIt, otherItEnd, it, otherIt, [&](const TValue& x, const TValue& y) { return x - y * value; });
-					std::transform<const TValue*>(copyOtherIt, copyOtherItEnd, copyIt, copyOtherIt, [&](const TValue& x, const TValue& y) { return x - y * value; });
-				}
-			}
+			_values[i * size + i] = _one;
 		}
 
-		it = _values + (size - 1) * size;
-		itEnd = it + size;
-		copyIt = copy._values + (size - 1) * size;
-		copyItEnd = copyIt + size;
-		for (uint64_t j = size - 1; j != UINT64_MAX; --j, it -= size, itEnd -= size, copyIt -= size, copyItEnd -= size)
-		{
-			otherIt = it - size;
-			otherItEnd = it;
-			copyOtherIt = copyIt - size;
-			copyOtherItEnd = copyIt;
-			for (uint64_t i = j - 1; i != UINT64_MAX; --i, otherIt -= size, otherItEnd -= size, copyOtherIt -= size, copyOtherItEnd -= size)
-			{
-				const TValue value = *(copyOtherIt + j);
-				if (value != _zero)
-				{
-					std::transform<const TValue*>(otherIt, otherItEnd, it, otherIt, [&](const TValue& x, const TValue& y) { return x - y * value; });
-					std::transform<const TValue*>(copyOtherIt, copyOtherItEnd, copyIt, copyOtherIt, [&](const TValue& x, const TValue& y) { return x - y * value; });
-				}
-			}
-		}
+		_scp::luSolve(size, factors.getData(), pivots.getData(), _values, size);
 	}
 
 	template<typename TValue>
@@ -266,200 +194,16 @@ namespace scp
 	{
 		assert(_shape.sizes[0] == _shape.sizes[1]);
 
-		TValue det = _one;
-
 		const uint64_t size = _shape.sizes[0];
-		Matrix<TValue> copy(*this);
-
-		TValue* it = nullptr;
-		TValue* otherIt = nullptr;
-		const TValue* itEnd = nullptr;
-		const TValue* otherItEnd = nullptr;
-
-		it = copy._values;
-		itEnd = it + size;
-		for (uint64_t j = 0; j < size; ++j, it += size + 1, itEnd += size)
-		{
-			const TValue pivot = *it;
-
-			if (pivot == _zero)
-			{
-				otherIt = it + size;
-				otherItEnd = itEnd + size;
-				for (uint64_t i = j + 1; i < size; ++i, otherIt += size, otherItEnd += size)
-				{
-					const TValue value = *otherIt;
-					if (value != _zero)
-					{
-						std::transform<const TValue*>(it, itEnd, otherIt, it, [&](const TValue& x, const TValue& y) { return x + y / value; });
-						break;
-					}
-				}
-
-				if (*it == _zero)
-				{
-					return _zero;
-				}
-			}
-			else if (pivot != _one)
-			{
-				det /= pivot;
-				std::transform<const TValue*>(it, itEnd, it, [&](const TValue& x) { return x / pivot; });
-			}
-
-			otherIt = it + size;
-			otherItEnd = itEnd + size;
-			for (uint64_t i = j + 1; i < size; ++i, otherIt += size, otherItEnd += size)
-			{
-				const TValue value = *otherIt;
-				if (value != _zero)
-				{
-					std::transform<const TValue*>(otherIt, otherItEnd, it, otherIt, [&](const TValue& x, const TValue& y) { return x - y * value; });
-				}
-			}
-		}
-
-		it = copy._values;
-		itEnd = it + _length + size;
-		for (; it != itEnd; it += size + 1)
-		{
-			det *= *it;
-		}
-
-		return det;
-	}
-
-
-	template<typename TValue>
-	constexpr Matrix<TValue> operator+(const Matrix<TValue>& matrixA, const Matrix<TValue>& matrixB)
-	{
-		Matrix<TValue> matrixC(matrixA);
-		matrixC += matrixB;
-		return matrixC;
-	}
-
-	template<typename TValue>
-	constexpr Matrix<TValue>&& operator+(Matrix<TValue>&& matrixA, const Matrix<TValue>& matrixB)
-	{
-		matrixA += matrixB;
-		return std::forward(matrixA);
-	}
-
-	template<typename TValue>
-	constexpr Matrix<TValue>&& operator+(const Matrix<TValue>& matrixA, Matrix<TValue>&& matrixB)
-	{
-		matrixB += matrixA;
-		return std::forward(matrixB);
-	}
-
-	template<typename TValue>
-	constexpr Matrix<TValue>&& operator+(Matrix<TValue>&& matrixA, Matrix<TValue>&& matrixB)
-	{
-		matrixA += matrixB;
-		return std::forward(matrixA);
-	}
-
-	template<typename TValue>
-	constexpr Matrix<TValue> operator-(const Matrix<TValue>& matrixA, const Matrix<TValue>& matrixB)
-	{
-		Matrix<TValue> matrixC(matrixA);
-		matrixC -= matrixB;
-		return matrixC;
-	}
-
-	template<typename TValue>
-	constexpr Matrix<TValue>&& operator-(Matrix<TValue>&& matrixA, const Matrix<TValue>& matrixB)
-	{
-		matrixA -= matrixB;
-		return std::forward(matrixA);
-	}
-
-	template<typename TValue>
-	constexpr Matrix<TValue>&& operator-(const Matrix<TValue>& matrixA, Matrix<TValue>&& matrixB)
-	{
-		matrixB -= matrixA;
-		matrixB.negate();
-		return std::forward(matrixB);
-	}
+		_scp::ScratchBuffer<TValue> factors(_length);
+		_scp::ScratchBuffer<uint64_t> pivots(size);
+		std::copy_n(_values, _length, factors.getData());
 
-	template<typename TValue>
-	constexpr Matrix<TValue>&& operator-(Matrix<TValue>&& matrixA, Matrix<TValue>&& matrixB)
-	{
-		matrixA -= matrixB;
-		return std::forward(matrixA);
-	}
-
-	template<typename TValue, typename TScalar>
-	constexpr Matrix<TValue> operator*(const Matrix<TValue>& matrix, const TScalar& scalar)
-	{
-		Matrix<TValue> copy(matrix);
-		copy *= scalar;
-		return copy;
-	}
-
-	template<typename TValue, typename TScalar>
-	constexpr Matrix<TValue>&& operator*(Matrix<TValue>&& matrix, const TScalar& scalar)
-	{
-		matrix *= scalar;
-		return std::forward(matrix);
-	}
+		const _scp::LUStatus status = _scp::luFactorize(size, factors.getData(), pivots.getData());
 
-	template<typename TValue, typename TScalar>
-	constexpr Matrix<TValue> operator*(const TScalar& scalar, const Matrix<TValue>& matrix)
-	{
-		Matrix<TValue> copy(matrix);
-		copy *= scalar;
-		return copy;
+		return _scp::luDeterminant(size, factors.getData(), status);
 	}
 
-	template<typename TValue, typename TScalar>
-	constexpr Matrix<TValue>&& operator*(const TScalar& scalar, Matrix<TValue>&& matrix)
-	{
-		matrix *= scalar;
-		return std::forward(matrix);
-	}
-
-	template<typename TValue, typename TScalar>
-	constexpr Matrix<TValue> operator/(const Matrix<TValue>& matrix, const TScalar& scalar)
-	{
-		Matrix<TValue> copy(matrix);
-		copy /= scalar;
-		return copy;
-	}
-
-	template<typename TValue, typename TScalar>
-	constexpr Matrix<TValue>&& operator/(Matrix<TValue>&& matrix, const TScalar& scalar)
-	{
-		matrix /= scalar;
-		return std::forward(matrix);
-	}
-
-	template<typename TValue>
-	constexpr Matrix<TValue> operator-(const Matrix<TValue>& matrix)
-	{
-		Matrix<TValue> copy(matrix);
-		copy.negate();
-		return copy;
-	}
-
-	template<typename TValue>
-	constexpr Matrix<TValue>&& operator-(Matrix<TValue>&& matrix)
-	{
-		matrix.negate();
-		return std::forward(matrix);
-	}
-
-	template<typename TValue>
-	constexpr Matrix<TValue> operator+(const Matrix<TValue>& matrix)
-	{
-		return matrix;
-	}
-
-	template<typename TValue>
-	constexpr Matrix<TValue>&& operator+(Matrix<TValue>&& matrix)
-	{
-		return std::forward(matrix);
-	}
 
 	template<typename TValue>
 	Matrix<TValue> operator*(const Matrix<TValue>& matrixA, const Matrix<TValue>& matrixB)
@@ -0,0 +1,177 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//! \file
+//! \author Plgrin Marius
+//! \copyright The MIT License (MIT)
+//! \date 2019-2024
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <SciPP/Core/CoreDecl.hpp>
+
+namespace scp
+{
+	inline ScratchArena::ScratchArena(uint64_t blockSize) :
+		_blockSize(blockSize),
+		_blocks(),
+		_block(0),
+		_offset(0)
+	{
+	}
+
+	inline void* ScratchArena::allocate(uint64_t size, uint64_t alignment)
+	{
+		assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+		while (true)
+		{
+			if (_block < _blocks.size())
+			{
+				const Block& block = _blocks[_block];
+				const uintptr_t begin = reinterpret_cast<uintptr_t>(block.memory);
+				const uintptr_t aligned = (begin + _offset + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+
+				if (aligned + size <= begin + block.size)
+				{
+					_offset = aligned + size - begin;
+					return reinterpret_cast<void*>(aligned);
+				}
+
+				if (_offset == 0)
+				{
+					// The block is empty but too small: all the following ones are free too, replace it by a larger one
+
+					::operator delete(block.memory, block.size, std::align_val_t(_blockAlignment));
+					_blocks.erase(_blocks.begin() + _block);
+				}
+				else
+				{
+					++_block;
+					_offset = 0;
+					continue;
+				}
+			}
+
+			const uint64_t blockSize = std::max(_blockSize, size + alignment);
+			_blocks.insert(_blocks.begin() + _block, { ::operator new(blockSize, std::align_val_t(_blockAlignment)), blockSize });
+			_offset = 0;
+		}
+	}
+
+	inline ScratchArena::Marker ScratchArena::getMarker() const
+	{
+		return { _block, _offset };
+	}
+
+	inline void ScratchArena::rewind(const Marker& marker)
+	{
+		assert(marker.block < _block || (marker.block == _block && marker.offset <= _offset));
+
+		_block = marker.block;
+		_offset = marker.offset;
+	}
+
+	inline void ScratchArena::reset()
+	{
+		_block = 0;
+		_offset = 0;
+	}
+
+	inline void ScratchArena::release()
+	{
+		assert(_block == 0 && _offset == 0);
+
+		for (const Block& block : _blocks)
+		{
+			::operator delete(block.memory, block.size, std::align_val_t(_blockAlignment));
+		}
+
+		_blocks.clear();
+	}
+
+	inline uint64_t ScratchArena::getCapacity() const
+	{
+		uint64_t capacity = 0;
+		for (const Block& block : _blocks)
+		{
+			capacity += block.size;
+		}
+
+		return capacity;
+	}
+
+	inline ScratchArena::~ScratchArena()
+	{
+		reset();
+		release();
+	}
+
+	namespace _scp
+	{
+		template<typename T>
+		constexpr ScratchBuffer<T>::ScratchBuffer(uint64_t size) :
+			_arena(nullptr),
+			_marker{ 0, 0 },
+			_data(nullptr),
+			_size(size)
+		{
+			if consteval
+			{
+				_data = new T[size];
+			}
+			else
+			{
+				_arena = scratchArena;
+				_marker = _arena->getMarker();
+				_data = static_cast<T*>(_arena->allocate(size * sizeof(T), std::max<uint64_t>(tensorAlignment, alignof(T))));
+				std::uninitialized_default_construct_n(_data, size);
+			}
+		}
+
+		template<typename T>
+		constexpr T& ScratchBuffer<T>::operator[](uint64_t i)
+		{
+			assert(i < _size);
+			return _data[i];
+		}
+
+		template<typename T>
+		constexpr const T& ScratchBuffer<T>::operator[](uint64_t i) const
+		{
+			assert(i < _size);
+			return _data[i];
+		}
+
+		template<typename T>
+		constexpr uint64_t ScratchBuffer<T>::getSize() const
+		{
+			return _size;
+		}
+
+		template<typename T>
+		constexpr T* ScratchBuffer<T>::getData()
+		{
+			return _data;
+		}
+
+		template<typename T>
+		constexpr const T* ScratchBuffer<T>::getData() const
+		{
+			return _data;
+		}
+
+		template<typename T>
+		constexpr ScratchBuffer<T>::~ScratchBuffer()
+		{
+			if (_arena)
+			{
+				std::destroy_n(_data, _size);
+				_arena->rewind(_marker);
+			}
+			else
+			{
+				delete[] _data;
+			}
+		}
+	}
+}
@@ -0,0 +1,930 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//! \file
+//! \author Plgrin Marius
+//! \copyright The MIT License (MIT)
+//! \date 2019-2024
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <SciPP/Core/CoreDecl.hpp>
+
+#ifdef SCP_SIMD_X86
+
+#define SCP_SIMD_BINARY_KERNEL(name, isa, target, eltType, vecType, width, load, store, op, scalarOp)	\
+SCP_SIMD_TARGET(target) inline void name##isa(eltType* dst, const eltType* src, uint64_t count)			\
+{																										\
+	uint64_t i = 0;																						\
+	for (; i + width <= count; i += width)																\
+	{																									\
+		const vecType x = load(dst + i);																\
+		const vecType y = load(src + i);																\
+		store(dst + i, op(x, y));																		\
+	}																									\
+																										\
+	for (; i < count; ++i)																				\
+	{																									\
+		dst[i] scalarOp src[i];																			\
+	}																									\
+}
+
+#define SCP_SIMD_SCALAR_KERNEL(name, isa, target, eltType, vecType, width, load, store, set1, op, scalarOp)	\
+SCP_SIMD_TARGET(target) inline void name##isa(eltType* dst, eltType scalar, uint64_t count)					\
+{																											\
+	const vecType y = set1(scalar);																			\
+																											\
+	uint64_t i = 0;																							\
+	for (; i + width <= count; i += width)																	\
+	{																										\
+		const vecType x = load(dst + i);																	\
+		store(dst + i, op(x, y));																			\
+	}																										\
+																											\
+	for (; i < count; ++i)																					\
+	{																										\
+		dst[i] scalarOp scalar;																				\
+	}																										\
+}
+
+#define SCP_SIMD_NEGATE_KERNEL(isa, target, eltType, vecType, width, load, store, set1, sub)	\
+SCP_SIMD_TARGET(target) inline void simdNegate##isa(eltType* dst, uint64_t count)				\
+{																								\
+	const vecType zero = set1(static_cast<eltType>(-0.0));										\
+																								\
+	uint64_t i = 0;																				\
+	for (; i + width <= count; i += width)														\
+	{																							\
+		store(dst + i, sub(zero, load(dst + i)));												\
+	}																							\
+																								\
+	for (; i < count; ++i)																		\
+	{																							\
+		dst[i] = -dst[i];																		\
+	}																							\
+}
+
+#define SCP_SIMD_MULTIPLY_ADD_KERNEL(isa, target, eltType, vecType, width, load, store, set1, add, mul)		\
+SCP_SIMD_TARGET(target) inline void simdMultiplyAdd##isa(eltType* dst, const eltType* src, eltType scalar, uint64_t count)	\
+{																										\
+	const vecType y = set1(scalar);																		\
+																										\
+	uint64_t i = 0;																						\
+	for (; i + width <= count; i += width)																\
+	{																									\
+		store(dst + i, add(load(dst + i), mul(load(src + i), y)));										\
+	}																									\
+																										\
+	for (; i < count; ++i)																				\
+	{																									\
+		dst[i] += src[i] * scalar;																		\
+	}																									\
+}
+
+#define SCP_SIMD_DOT_KERNEL(isa, target, eltType, vecType, width, load, store, setzero, add, mul)	\
+SCP_SIMD_TARGET(target) inline eltType simdDot##isa(const eltType* x, const eltType* y, uint64_t count)	\
+{																										\
+	vecType sum0 = setzero();																			\
+	vecType sum1 = setzero();																			\
+																										\
+	uint64_t i = 0;																						\
+	for (; i + 2 * width <= count; i += 2 * width)														\
+	{																									\
+		sum0 = add(sum0, mul(load(x + i), load(y + i)));												\
+		sum1 = add(sum1, mul(load(x + i + width), load(y + i + width)));								\
+	}																									\
+																										\
+	for (; i + width <= count; i += width)																\
+	{																									\
+		sum0 = add(sum0, mul(load(x + i), load(y + i)));												\
+	}																									\
+																										\
+	eltType lanes[width];																				\
+	store(lanes, add(sum0, sum1));																		\
+																										\
+	eltType sum = 0;																					\
+	for (uint64_t j = 0; j < width; ++j)																\
+	{																									\
+		sum += lanes[j];																				\
+	}																									\
+																										\
+	for (; i < count; ++i)																				\
+	{																									\
+		sum += x[i] * y[i];																				\
+	}																									\
+																										\
+	return sum;																							\
+}
+
+#define SCP_SIMD_KERNELS(isa, target, eltType, vecType, width, prefix, suffix)													\
+SCP_SIMD_BINARY_KERNEL(simdAdd, isa, target, eltType, vecType, width, prefix##_loadu_##suffix, prefix##_storeu_##suffix, prefix##_add_##suffix, +=)	\
+SCP_SIMD_BINARY_KERNEL(simdSub, isa, target, eltType, vecType, width, prefix##_loadu_##suffix, prefix##_storeu_##suffix, prefix##_sub_##suffix, -=)	\
+SCP_SIMD_BINARY_KERNEL(simdMultiply, isa, target, eltType, vecType, width, prefix##_loadu_##suffix, prefix##_storeu_##suffix, prefix##_mul_##suffix, *=)	\
+SCP_SIMD_SCALAR_KERNEL(simdScale, isa, target, eltType, vecType, width, prefix##_loadu_##suffix, prefix##_storeu_##suffix, prefix##_set1_##suffix, prefix##_mul_##suffix, *=)	\
+SCP_SIMD_SCALAR_KERNEL(simdDivide, isa, target, eltType, vecType, width, prefix##_loadu_##suffix, prefix##_storeu_##suffix, prefix##_set1_##suffix, prefix##_div_##suffix, /=)	\
+SCP_SIMD_NEGATE_KERNEL(isa, target, eltType, vecType, width, prefix##_loadu_##suffix, prefix##_storeu_##suffix, prefix##_set1_##suffix, prefix##_sub_##suffix)	\
+SCP_SIMD_MULTIPLY_ADD_KERNEL(isa, target, eltType, vecType, width, prefix##_loadu_##suffix, prefix##_storeu_##suffix, prefix##_set1_##suffix, prefix##_add_##suffix, prefix##_mul_##suffix)	\
+SCP_SIMD_DOT_KERNEL(isa, target, eltType, vecType, width, prefix##_loadu_##suffix, prefix##_storeu_##suffix, prefix##_setzero_##suffix, prefix##_add_##suffix, prefix##_mul_##suffix)
+
+// Stockham butterflies for a fixed twiddle index: element i of input k is src[i + k.srcStride], element i of output l is
+// dst[i + l.dstStride], multiplied by twiddles[l - 1] for l != 0. Strides and counts are in complex units, the number of
+// elements processed is returned and the remainder is left to the caller.
+
+#define SCP_SIMD_FFT_KERNELS(isa, target, eltType, vecType, width, prefix, suffix)											\
+SCP_SIMD_TARGET(target) inline uint64_t simdFftRadix2##isa(const eltType* src, uint64_t srcStride, eltType* dst, uint64_t dstStride, const eltType* twiddles, uint64_t count)	\
+{																															\
+	const vecType w1Re = prefix##_set1_##suffix(twiddles[0]);																\
+	const vecType w1Im = prefix##_set1_##suffix(twiddles[1]);																\
+																															\
+	uint64_t i = 0;																											\
+	for (; i + width <= count; i += width)																					\
+	{																														\
+		const vecType a0 = prefix##_loadu_##suffix(src + 2 * i);															\
+		const vecType a1 = prefix##_loadu_##suffix(src + 2 * (i + srcStride));												\
+																															\
+		prefix##_storeu_##suffix(dst + 2 * i, prefix##_add_##suffix(a0, a1));												\
+		prefix##_storeu_##suffix(dst + 2 * (i + dstStride), complexMul##isa(prefix##_sub_##suffix(a0, a1), w1Re, w1Im));	\
+	}																														\
+																															\
+	return i;																												\
+}																															\
+																															\
+SCP_SIMD_TARGET(target) inline uint64_t simdFftRadix4##isa(const eltType* src, uint64_t srcStride, eltType* dst, uint64_t dstStride, const eltType* twiddles, uint64_t count)	\
+{																															\
+	const vecType zero = prefix##_set1_##suffix(0);																			\
+	const vecType minusOne = prefix##_set1_##suffix(-1);																	\
+	const vecType w1Re = prefix##_set1_##suffix(twiddles[0]);																\
+	const vecType w1Im = prefix##_set1_##suffix(twiddles[1]);																\
+	const vecType w2Re = prefix##_set1_##suffix(twiddles[2]);																\
+	const vecType w2Im = prefix##_set1_##suffix(twiddles[3]);																\
+	const vecType w3Re = prefix##_set1_##suffix(twiddles[4]);																\
+	const vecType w3Im = prefix##_set1_##suffix(twiddles[5]);																\
+																															\
+	uint64_t i = 0;																											\
+	for (; i + width <= count; i += width)																					\
+	{																														\
+		const vecType a0 = prefix##_loadu_##suffix(src + 2 * i);															\
+		const vecType a1 = prefix##_loadu_##suffix(src + 2 * (i + srcStride));												\
+		const vecType a2 = prefix##_loadu_##suffix(src + 2 * (i + 2 * srcStride));											\
+		const vecType a3 = prefix##_loadu_##suffix(src + 2 * (i + 3 * srcStride));											\
+																															\
+		const vecType b0 = prefix##_add_##suffix(a0, a2);																	\
+		const vecType b1 = prefix##_sub_##suffix(a0, a2);																	\
+		const vecType b2 = prefix##_add_##suffix(a1, a3);																	\
+		const vecType b3 = complexMul##isa(prefix##_sub_##suffix(a1, a3), zero, minusOne);									\
+																															\
+		prefix##_storeu_##suffix(dst + 2 * i, prefix##_add_##suffix(b0, b2));												\
+		prefix##_storeu_##suffix(dst + 2 * (i + dstStride), complexMul##isa(prefix##_add_##suffix(b1, b3), w1Re, w1Im));	\
+		prefix##_storeu_##suffix(dst + 2 * (i + 2 * dstStride), complexMul##isa(prefix##_sub_##suffix(b0, b2), w2Re, w2Im));	\
+		prefix##_storeu_##suffix(dst + 2 * (i + 3 * dstStride), complexMul##isa(prefix##_sub_##suffix(b1, b3), w3Re, w3Im));	\
+	}																														\
+																															\
+	return i;																												\
+}																															\
+																															\
+SCP_SIMD_TARGET(target) inline uint64_t simdFftRadix8##isa(const eltType* src, uint64_t srcStride, eltType* dst, uint64_t dstStride, const eltType* twiddles, uint64_t count)	\
+{																															\
+	const eltType halfSqrt2 = std::numbers::sqrt2_v<eltType> / 2;															\
+	const vecType zero = prefix##_set1_##suffix(0);																			\
+	const vecType minusOne = prefix##_set1_##suffix(-1);																	\
+	const vecType c = prefix##_set1_##suffix(halfSqrt2);																	\
+	const vecType minusC = prefix##_set1_##suffix(-halfSqrt2);																\
+																															\
+	vecType wRe[7], wIm[7];																									\
+	for (uint64_t l = 0; l < 7; ++l)																						\
+	{																														\
+		wRe[l] = prefix##_set1_##suffix(twiddles[2 * l]);																	\
+		wIm[l] = prefix##_set1_##suffix(twiddles[2 * l + 1]);																\
+	}																														\
+																															\
+	uint64_t i = 0;																											\
+	for (; i + width <= count; i += width)																					\
+	{																														\
+		vecType a[8];																										\
+		for (uint64_t k = 0; k < 8; ++k)																					\
+		{																													\
+			a[k] = prefix##_loadu_##suffix(src + 2 * (i + k * srcStride));													\
+		}																													\
+																															\
+		const vecType e0 = prefix##_add_##suffix(a[0], a[4]);																\
+		const vecType e1 = prefix##_add_##suffix(a[1], a[5]);																\
+		const vecType e2 = prefix##_add_##suffix(a[2], a[6]);																\
+		const vecType e3 = prefix##_add_##suffix(a[3], a[7]);																\
+		const vecType o0 = prefix##_sub_##suffix(a[0], a[4]);																\
+		const vecType o1 = complexMul##isa(prefix##_sub_##suffix(a[1], a[5]), c, minusC);									\
+		const vecType o2 = complexMul##isa(prefix##_sub_##suffix(a[2], a[6]), zero, minusOne);								\
+		const vecType o3 = complexMul##isa(prefix##_sub_##suffix(a[3], a[7]), minusC, minusC);								\
+																															\
+		const vecType eA = prefix##_add_##suffix(e0, e2);																	\
+		const vecType eB = prefix##_sub_##suffix(e0, e2);																	\
+		const vecType eC = prefix##_add_##suffix(e1, e3);																	\
+		const vecType eD = complexMul##isa(prefix##_sub_##suffix(e1, e3), zero, minusOne);									\
+		const vecType oA = prefix##_add_##suffix(o0, o2);																	\
+		const vecType oB = prefix##_sub_##suffix(o0, o2);																	\
+		const vecType oC = prefix##_add_##suffix(o1, o3);																	\
+		const vecType oD = complexMul##isa(prefix##_sub_##suffix(o1, o3), zero, minusOne);									\
+																															\
+		prefix##_storeu_##suffix(dst + 2 * i, prefix##_add_##suffix(eA, eC));												\
+		prefix##_storeu_##suffix(dst + 2 * (i + dstStride), complexMul##isa(prefix##_add_##suffix(oA, oC), wRe[0], wIm[0]));	\
+		prefix##_storeu_##suffix(dst + 2 * (i + 2 * dstStride), complexMul##isa(prefix##_add_##suffix(eB, eD), wRe[1], wIm[1]));	\
+		prefix##_storeu_##suffix(dst + 2 * (i + 3 * dstStride), complexMul##isa(prefix##_add_##suffix(oB, oD), wRe[2], wIm[2]));	\
+		prefix##_storeu_##suffix(dst + 2 * (i + 4 * dstStride), complexMul##isa(prefix##_sub_##suffix(eA, eC), wRe[3], wIm[3]));	\
+		prefix##_storeu_##suffix(dst + 2 * (i + 5 * dstStride), complexMul##isa(prefix##_sub_##suffix(oA, oC), wRe[4], wIm[4]));	\
+		prefix##_storeu_##suffix(dst + 2 * (i + 6 * dstStride), complexMul##isa(prefix##_sub_##suffix(eB, eD), wRe[5], wIm[5]));	\
+		prefix##_storeu_##suffix(dst + 2 * (i + 7 * dstStride), complexMul##isa(prefix##_sub_##suffix(oB, oD), wRe[6], wIm[6]));	\
+	}																														\
+																															\
+	return i;																												\
+}
+
+// Packed matrix product tile of rows x (2.width) elements. Each step of the depth loads one row of the b panel in two
+// vectors and broadcasts one column of the a panel, the accumulators staying in registers until the end.
+
+#define SCP_SIMD_GEMM_KERNEL(isa, target, eltType, vecType, width, rows, prefix, suffix)							\
+SCP_SIMD_TARGET(target) inline void simdGemmKernel##isa(uint64_t depth, const eltType* a, const eltType* b, eltType* c, uint64_t ldc)	\
+{																													\
+	vecType acc[rows][2];																							\
+	SCP_SIMD_UNROLL																									\
+	for (uint64_t r = 0; r < rows; ++r)																				\
+	{																												\
+		acc[r][0] = prefix##_setzero_##suffix();																	\
+		acc[r][1] = prefix##_setzero_##suffix();																	\
+	}																												\
+																													\
+	for (uint64_t p = 0; p < depth; ++p, a += rows, b += 2 * width)													\
+	{																												\
+		const vecType b0 = prefix##_loadu_##suffix(b);																\
+		const vecType b1 = prefix##_loadu_##suffix(b + width);														\
+																													\
+		SCP_SIMD_UNROLL																								\
+		for (uint64_t r = 0; r < rows; ++r)																			\
+		{																											\
+			const vecType x = prefix##_set1_##suffix(a[r]);															\
+			acc[r][0] = prefix##_fmadd_##suffix(x, b0, acc[r][0]);													\
+			acc[r][1] = prefix##_fmadd_##suffix(x, b1, acc[r][1]);													\
+		}																											\
+	}																												\
+																													\
+	SCP_SIMD_UNROLL																									\
+	for (uint64_t r = 0; r < rows; ++r, c += ldc)																	\
+	{																												\
+		prefix##_storeu_##suffix(c, prefix##_add_##suffix(prefix##_loadu_##suffix(c), acc[r][0]));					\
+		prefix##_storeu_##suffix(c + width, prefix##_add_##suffix(prefix##_loadu_##suffix(c + width), acc[r][1]));	\
+	}																												\
+}
+
+#endif
+
+namespace scp
+{
+	namespace _scp
+	{
+		#ifdef SCP_SIMD_X86
+
+		SCP_SIMD_KERNELS(Sse2, "sse2", float, __m128, 4, _mm, ps)
+		SCP_SIMD_KERNELS(Sse2, "sse2", double, __m128d, 2, _mm, pd)
+		SCP_SIMD_KERNELS(Avx2, "avx2", float, __m256, 8, _mm256, ps)
+		SCP_SIMD_KERNELS(Avx2, "avx2", double, __m256d, 4, _mm256, pd)
+		SCP_SIMD_KERNELS(Avx512, "avx512f", float, __m512, 16, _mm512, ps)
+		SCP_SIMD_KERNELS(Avx512, "avx512f", double, __m512d, 8, _mm512, pd)
+
+		// Complex products on interleaved (real, imag) arrays: (a + ib)(c + id) = (ac - bd) + i(bc + ad)
+
+		SCP_SIMD_TARGET("sse2") inline __m128 complexMulSse2(__m128 x, __m128 yRe, __m128 yIm)
+		{
+			const __m128 sign = _mm_setr_ps(-0.f, 0.f, -0.f, 0.f);
+			const __m128 xSwap = _mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 3, 0, 1));
+			return _mm_add_ps(_mm_mul_ps(x, yRe), _mm_xor_ps(_mm_mul_ps(xSwap, yIm), sign));
+		}
+
+		SCP_SIMD_TARGET("sse2") inline __m128d complexMulSse2(__m128d x, __m128d yRe, __m128d yIm)
+		{
+			const __m128d sign = _mm_setr_pd(-0.0, 0.0);
+			const __m128d xSwap = _mm_shuffle_pd(x, x, 1);
+			return _mm_add_pd(_mm_mul_pd(x, yRe), _mm_xor_pd(_mm_mul_pd(xSwap, yIm), sign));
+		}
+
+		SCP_SIMD_TARGET("avx2") inline __m256 complexMulAvx2(__m256 x, __m256 yRe, __m256 yIm)
+		{
+			return _mm256_addsub_ps(_mm256_mul_ps(x, yRe), _mm256_mul_ps(_mm256_permute_ps(x, 0xB1), yIm));
+		}
+
+		SCP_SIMD_TARGET("avx2") inline __m256d complexMulAvx2(__m256d x, __m256d yRe, __m256d yIm)
+		{
+			return _mm256_addsub_pd(_mm256_mul_pd(x, yRe), _mm256_mul_pd(_mm256_permute_pd(x, 0x5), yIm));
+		}
+
+		// The masked forms of the AVX-512 shuffles are used on purpose, the unmasked ones trigger -Wmaybe-uninitialized on GCC
+
+		SCP_SIMD_TARGET("avx512f") inline __m512 complexMulAvx512(__m512 x, __m512 yRe, __m512 yIm)
+		{
+			const __m512 a = _mm512_mul_ps(x, yRe);
+			const __m512 b = _mm512_mul_ps(_mm512_mask_permute_ps(x, 0xFFFF, x, 0xB1), yIm);
+			return _mm512_mask_sub_ps(_mm512_add_ps(a, b), 0x5555, a, b);
+		}
+
+		SCP_SIMD_TARGET("avx512f") inline __m512d complexMulAvx512(__m512d x, __m512d yRe, __m512d yIm)
+		{
+			const __m512d a = _mm512_mul_pd(x, yRe);
+			const __m512d b = _mm512_mul_pd(_mm512_mask_permute_pd(x, 0xFF, x, 0x55), yIm);
+			return _mm512_mask_sub_pd(_mm512_add_pd(a, b), 0x55, a, b);
+		}
+
+		SCP_SIMD_FFT_KERNELS(Sse2, "sse2", float, __m128, 2, _mm, ps)
+		SCP_SIMD_FFT_KERNELS(Sse2, "sse2", double, __m128d, 1, _mm, pd)
+		SCP_SIMD_FFT_KERNELS(Avx2, "avx2", float, __m256, 4, _mm256, ps)
+		SCP_SIMD_FFT_KERNELS(Avx2, "avx2", double, __m256d, 2, _mm256, pd)
+		SCP_SIMD_FFT_KERNELS(Avx512, "avx512f", float, __m512, 8, _mm512, ps)
+		SCP_SIMD_FFT_KERNELS(Avx512, "avx512f", double, __m512d, 4, _mm512, pd)
+
+		// 15 of the 16 AVX2 registers and 27 of the 32 AVX-512 ones are used
+
+		SCP_SIMD_GEMM_KERNEL(Avx2, "avx2,fma", float, __m256, 8, 6, _mm256, ps)
+		SCP_SIMD_GEMM_KERNEL(Avx2, "avx2,fma", double, __m256d, 4, 6, _mm256, pd)
+		SCP_SIMD_GEMM_KERNEL(Avx512, "avx512f", float, __m512, 16, 12, _mm512, ps)
+		SCP_SIMD_GEMM_KERNEL(Avx512, "avx512f", double, __m512d, 8, 12, _mm512, pd)
+
+		SCP_SIMD_TARGET("sse2") inline void simdComplexMultiplySse2(float* dst, const float* src, uint64_t count)
+		{
+			uint64_t i = 0;
+			for (; i + 2 <= count; i += 2)
+			{
+				const __m128 y = _mm_loadu_ps(src + 2 * i);
+				const __m128 yRe = _mm_shuffle_ps(y, y, _MM_SHUFFLE(2, 2, 0, 0));
+				const __m128 yIm = _mm_shuffle_ps(y, y, _MM_SHUFFLE(3, 3, 1, 1));
+				_mm_storeu_ps(dst + 2 * i, complexMulSse2(_mm_loadu_ps(dst + 2 * i), yRe, yIm));
+			}
+
+			for (; i < count; ++i)
+			{
+				reinterpret_cast<std::complex<float>*>(dst)[i] *= reinterpret_cast<const std::complex<float>*>(src)[i];
+			}
+		}
+
+		SCP_SIMD_TARGET("sse2") inline void simdComplexMultiplySse2(double* dst, const double* src, uint64_t count)
+		{
+			for (uint64_t i = 0; i < count; ++i)
+			{
+				const __m128d y = _mm_loadu_pd(src + 2 * i);
+				const __m128d yRe = _mm_shuffle_pd(y, y, 0);
+				const __m128d yIm = _mm_shuffle_pd(y, y, 3);
+				_mm_storeu_pd(dst + 2 * i, complexMulSse2(_mm_loadu_pd(dst + 2 * i), yRe, yIm));
+			}
+		}
+
+		SCP_SIMD_TARGET("avx2") inline void simdComplexMultiplyAvx2(float* dst, const float* src, uint64_t count)
+		{
+			uint64_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m256 y = _mm256_loadu_ps(src + 2 * i);
+				_mm256_storeu_ps(dst + 2 * i, complexMulAvx2(_mm256_loadu_ps(dst + 2 * i), _mm256_moveldup_ps(y), _mm256_movehdup_ps(y)));
+			}
+
+			for (; i < count; ++i)
+			{
+				reinterpret_cast<std::complex<float>*>(dst)[i] *= reinterpret_cast<const std::complex<float>*>(src)[i];
+			}
+		}
+
+		SCP_SIMD_TARGET("avx2") inline void simdComplexMultiplyAvx2(double* dst, const double* src, uint64_t count)
+		{
+			uint64_t i = 0;
+			for (; i + 2 <= count; i += 2)
+			{
+				const __m256d y = _mm256_loadu_pd(src + 2 * i);
+				_mm256_storeu_pd(dst + 2 * i, complexMulAvx2(_mm256_loadu_pd(dst + 2 * i), _mm256_movedup_pd(y), _mm256_permute_pd(y, 0xF)));
+			}
+
+			for (; i < count; ++i)
+			{
+				reinterpret_cast<std::complex<double>*>(dst)[i] *= reinterpret_cast<const std::complex<double>*>(src)[i];
+			}
+		}
+
+		SCP_SIMD_TARGET("avx512f") inline void simdComplexMultiplyAvx512(float* dst, const float* src, uint64_t count)
+		{
+			uint64_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				const __m512 y = _mm512_loadu_ps(src + 2 * i);
+				_mm512_storeu_ps(dst + 2 * i, complexMulAvx512(_mm512_loadu_ps(dst + 2 * i), _mm512_mask_moveldup_ps(y, 0xFFFF, y), _mm512_mask_movehdup_ps(y, 0xFFFF, y)));
+			}
+
+			for (; i < count; ++i)
+			{
+				reinterpret_cast<std::complex<float>*>(dst)[i] *= reinterpret_cast<const std::complex<float>*>(src)[i];
+			}
+		}
+
+		SCP_SIMD_TARGET("avx512f") inline void simdComplexMultiplyAvx512(double* dst, const double* src, uint64_t count)
+		{
+			uint64_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m512d y = _mm512_loadu_pd(src + 2 * i);
+				_mm512_storeu_pd(dst + 2 * i, complexMulAvx512(_mm512_loadu_pd(dst + 2 * i), _mm512_mask_movedup_pd(y, 0xFF, y), _mm512_mask_permute_pd(y, 0xFF, y, 0xFF)));
+			}
+
+			for (; i < count; ++i)
+			{
+				reinterpret_cast<std::complex<double>*>(dst)[i] *= reinterpret_cast<const std::complex<double>*>(src)[i];
+			}
+		}
+
+		SCP_SIMD_TARGET("sse2") inline void simdComplexScaleSse2(float* dst, float re, float im, uint64_t count)
+		{
+			const __m128 yRe = _mm_set1_ps(re);
+			const __m128 yIm = _mm_set1_ps(im);
+
+			uint64_t i = 0;
+			for (; i + 2 <= count; i += 2)
+			{
+				_mm_storeu_ps(dst + 2 * i, complexMulSse2(_mm_loadu_ps(dst + 2 * i), yRe, yIm));
+			}
+
+			for (; i < count; ++i)
+			{
+				reinterpret_cast<std::complex<float>*>(dst)[i] *= std::complex<float>(re, im);
+			}
+		}
+
+		SCP_SIMD_TARGET("sse2") inline void simdComplexScaleSse2(double* dst, double re, double im, uint64_t count)
+		{
+			const __m128d yRe = _mm_set1_pd(re);
+			const __m128d yIm = _mm_set1_pd(im);
+
+			for (uint64_t i = 0; i < count; ++i)
+			{
+				_mm_storeu_pd(dst + 2 * i, complexMulSse2(_mm_loadu_pd(dst + 2 * i), yRe, yIm));
+			}
+		}
+
+		SCP_SIMD_TARGET("avx2") inline void simdComplexScaleAvx2(float* dst, float re, float im, uint64_t count)
+		{
+			const __m256 yRe = _mm256_set1_ps(re);
+			const __m256 yIm = _mm256_set1_ps(im);
+
+			uint64_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				_mm256_storeu_ps(dst + 2 * i, complexMulAvx2(_mm256_loadu_ps(dst + 2 * i), yRe, yIm));
+			}
+
+			for (; i < count; ++i)
+			{
+				reinterpret_cast<std::complex<float>*>(dst)[i] *= std::complex<float>(re, im);
+			}
+		}
+
+		SCP_SIMD_TARGET("avx2") inline void simdComplexScaleAvx2(double* dst, double re, double im, uint64_t count)
+		{
+			const __m256d yRe = _mm256_set1_pd(re);
+			const __m256d yIm = _mm256_set1_pd(im);
+
+			uint64_t i = 0;
+			for (; i + 2 <= count; i += 2)
+			{
+				_mm256_storeu_pd(dst + 2 * i, complexMulAvx2(_mm256_loadu_pd(dst + 2 * i), yRe, yIm));
+			}
+
+			for (; i < count; ++i)
+			{
+				reinterpret_cast<std::complex<double>*>(dst)[i] *= std::complex<double>(re, im);
+			}
+		}
+
+		SCP_SIMD_TARGET("avx512f") inline void simdComplexScaleAvx512(float* dst, float re, float im, uint64_t count)
+		{
+			const __m512 yRe = _mm512_set1_ps(re);
+			const __m512 yIm = _mm512_set1_ps(im);
+
+			uint64_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				_mm512_storeu_ps(dst + 2 * i, complexMulAvx512(_mm512_loadu_ps(dst + 2 * i), yRe, yIm));
+			}
+
+			for (; i < count; ++i)
+			{
+				reinterpret_cast<std::complex<float>*>(dst)[i] *= std::complex<float>(re, im);
+			}
+		}
+
+		SCP_SIMD_TARGET("avx512f") inline void simdComplexScaleAvx512(double* dst, double re, double im, uint64_t count)
+		{
+			const __m512d yRe = _mm512_set1_pd(re);
+			const __m512d yIm = _mm512_set1_pd(im);
+
+			uint64_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				_mm512_storeu_pd(dst + 2 * i, complexMulAvx512(_mm512_loadu_pd(dst + 2 * i), yRe, yIm));
+			}
+
+			for (; i < count; ++i)
+			{
+				reinterpret_cast<std::complex<double>*>(dst)[i] *= std::complex<double>(re, im);
+			}
+		}
+
+		#endif
+
+		inline SimdLevel getSimdLevel()
+		{
+			static const SimdLevel level = []()
+			{
+				#if defined(SCP_SIMD_X86) && defined(_MSC_VER) && !defined(__clang__)
+					int info[4];
+
+					__cpuid(info, 0);
+					const int maxLeaf = info[0];
+
+					__cpuid(info, 1);
+					const bool sse2 = info[3] & (1 << 26);
+					const bool osxsave = info[2] & (1 << 27);
+					const uint64_t xcr0 = osxsave ? _xgetbv(0) : 0;
+
+					bool avx2 = false;
+					bool avx512 = false;
+					if (maxLeaf >= 7)
+					{
+						__cpuidex(info, 7, 0);
+						avx2 = (info[1] & (1 << 5)) && (xcr0 & 0x06) == 0x06;
+						avx512 = (info[1] & (1 << 16)) && (xcr0 & 0xE6) == 0xE6;
+					}
+
+					return avx512 ? SimdLevel::Avx512 : (avx2 ? SimdLevel::Avx2 : (sse2 ? SimdLevel::Sse2 : SimdLevel::None));
+				#elif defined(SCP_SIMD_X86)
+					__builtin_cpu_init();
+
+					if (__builtin_cpu_supports("avx512f"))
+					{
+						return SimdLevel::Avx512;
+					}
+					else if (__builtin_cpu_supports("avx2"))
+					{
+						return SimdLevel::Avx2;
+					}
+					else if (__builtin_cpu_supports("sse2"))
+					{
+						return SimdLevel::Sse2;
+					}
+
+					return SimdLevel::None;
+				#else
+					return SimdLevel::None;
+				#endif
+			}();
+
+			return level;
+		}
+
+		inline bool hasSimdFma()
+		{
+			static const bool fma = []()
+			{
+				#if defined(SCP_SIMD_X86) && defined(_MSC_VER) && !defined(__clang__)
+					int info[4];
+					__cpuid(info, 1);
+					return (info[2] & (1 << 12)) && (info[2] & (1 << 27)) && (_xgetbv(0) & 0x06) == 0x06;
+				#elif defined(SCP_SIMD_X86)
+					__builtin_cpu_init();
+					return __builtin_cpu_supports("fma") != 0;
+				#else
+					return false;
+				#endif
+			}();
+
+			return fma;
+		}
+
+		template<CSimdValue TValue>
+		void simdAdd(TValue* dst, const TValue* src, uint64_t count)
+		{
+			using TReal = typename SimdRealType<TValue>::Type;
+
+			TReal* realDst = reinterpret_cast<TReal*>(dst);
+			const TReal* realSrc = reinterpret_cast<const TReal*>(src);
+			const uint64_t realCount = count * (sizeof(TValue) / sizeof(TReal));
+
+			#ifdef SCP_SIMD_X86
+			switch (getSimdLevel())
+			{
+				case SimdLevel::Avx512: return simdAddAvx512(realDst, realSrc, realCount);
+				case SimdLevel::Avx2: return simdAddAvx2(realDst, realSrc, realCount);
+				case SimdLevel::Sse2: return simdAddSse2(realDst, realSrc, realCount);
+				default: break;
+			}
+			#endif
+
+			for (uint64_t i = 0; i < realCount; ++i)
+			{
+				realDst[i] += realSrc[i];
+			}
+		}
+
+		template<CSimdValue TValue>
+		void simdSub(TValue* dst, const TValue* src, uint64_t count)
+		{
+			using TReal = typename SimdRealType<TValue>::Type;
+
+			TReal* realDst = reinterpret_cast<TReal*>(dst);
+			const TReal* realSrc = reinterpret_cast<const TReal*>(src);
+			const uint64_t realCount = count * (sizeof(TValue) / sizeof(TReal));
+
+			#ifdef SCP_SIMD_X86
+			switch (getSimdLevel())
+			{
+				case SimdLevel::Avx512: return simdSubAvx512(realDst, realSrc, realCount);
+				case SimdLevel::Avx2: return simdSubAvx2(realDst, realSrc, realCount);
+				case SimdLevel::Sse2: return simdSubSse2(realDst, realSrc, realCount);
+				default: break;
+			}
+			#endif
+
+			for (uint64_t i = 0; i < realCount; ++i)
+			{
+				realDst[i] -= realSrc[i];
+			}
+		}
+
+		template<CSimdValue TValue>
+		void simdMultiply(TValue* dst, const TValue* src, uint64_t count)
+		{
+			using TReal = typename SimdRealType<TValue>::Type;
+
+			#ifdef SCP_SIMD_X86
+			TReal* realDst = reinterpret_cast<TReal*>(dst);
+			const TReal* realSrc = reinterpret_cast<const TReal*>(src);
+
+			if constexpr (CComplex<TValue>)
+			{
+				switch (getSimdLevel())
+				{
+					case SimdLevel::Avx512: return simdComplexMultiplyAvx512(realDst, realSrc, count);
+					case SimdLevel::Avx2: return simdComplexMultiplyAvx2(realDst, realSrc, count);
+					case SimdLevel::Sse2: return simdComplexMultiplySse2(realDst, realSrc, count);
+					default: break;
+				}
+			}
+			else
+			{
+				switch (getSimdLevel())
+				{
+					case SimdLevel::Avx512: return simdMultiplyAvx512(realDst, realSrc, count);
+					case SimdLevel::Avx2: return simdMultiplyAvx2(realDst, realSrc, count);
+					case SimdLevel::Sse2: return simdMultiplySse2(realDst, realSrc, count);
+					default: break;
+				}
+			}
+			#endif
+
+			for (uint64_t i = 0; i < count; ++i)
+			{
+				dst[i] *= src[i];
+			}
+		}
+
+		template<CSimdValue TValue>
+		void simdScale(TValue* dst, const typename SimdRealType<TValue>::Type& scalar, uint64_t count)
+		{
+			using TReal = typename SimdRealType<TValue>::Type;
+
+			TReal* realDst = reinterpret_cast<TReal*>(dst);
+			const uint64_t realCount = count * (sizeof(TValue) / sizeof(TReal));
+
+			#ifdef SCP_SIMD_X86
+			switch (getSimdLevel())
+			{
+				case SimdLevel::Avx512: return simdScaleAvx512(realDst, scalar, realCount);
+				case SimdLevel::Avx2: return simdScaleAvx2(realDst, scalar, realCount);
+				case SimdLevel::Sse2: return simdScaleSse2(realDst, scalar, realCount);
+				default: break;
+			}
+			#endif
+
+			for (uint64_t i = 0; i < realCount; ++i)
+			{
+				realDst[i] *= scalar;
+			}
+		}
+
+		template<CSimdValue TValue> requires CComplex<TValue>
+		void simdScale(TValue* dst, const TValue& scalar, uint64_t count)
+		{
+			#ifdef SCP_SIMD_X86
+			using TReal = typename SimdRealType<TValue>::Type;
+
+			TReal* realDst = reinterpret_cast<TReal*>(dst);
+
+			switch (getSimdLevel())
+			{
+				case SimdLevel::Avx512: return simdComplexScaleAvx512(realDst, scalar.real(), scalar.imag(), count);
+				case SimdLevel::Avx2: return simdComplexScaleAvx2(realDst, scalar.real(), scalar.imag(), count);
+				case SimdLevel::Sse2: return simdComplexScaleSse2(realDst, scalar.real(), scalar.imag(), count);
+				default: break;
+			}
+			#endif
+
+			for (uint64_t i = 0; i < count; ++i)
+			{
+				dst[i] *= scalar;
+			}
+		}
+
+		template<CSimdValue TValue>
+		void simdDivide(TValue* dst, const typename SimdRealType<TValue>::Type& scalar, uint64_t count)
+		{
+			using TReal = typename SimdRealType<TValue>::Type;
+
+			TReal* realDst = reinterpret_cast<TReal*>(dst);
+			const uint64_t realCount = count * (sizeof(TValue) / sizeof(TReal));
+
+			#ifdef SCP_SIMD_X86
+			switch (getSimdLevel())
+			{
+				case SimdLevel::Avx512: return simdDivideAvx512(realDst, scalar, realCount);
+				case SimdLevel::Avx2: return simdDivideAvx2(realDst, scalar, realCount);
+				case SimdLevel::Sse2: return simdDivideSse2(realDst, scalar, realCount);
+				default: break;
+			}
+			#endif
+
+			for (uint64_t i = 0; i < realCount; ++i)
+			{
+				realDst[i] /= scalar;
+			}
+		}
+
+		template<CSimdValue TValue>
+		void simdNegate(TValue* dst, uint64_t count)
+		{
+			using TReal = typename SimdRealType<TValue>::Type;
+
+			TReal* realDst = reinterpret_cast<TReal*>(dst);
+			const uint64_t realCount = count * (sizeof(TValue) / sizeof(TReal));
+
+			#ifdef SCP_SIMD_X86
+			switch (getSimdLevel())
+			{
+				case SimdLevel::Avx512: return simdNegateAvx512(realDst, realCount);
+				case SimdLevel::Avx2: return simdNegateAvx2(realDst, realCount);
+				case SimdLevel::Sse2: return simdNegateSse2(realDst, realCount);
+				default: break;
+			}
+			#endif
+
+			for (uint64_t i = 0; i < realCount; ++i)
+			{
+				realDst[i] = -realDst[i];
+			}
+		}
+
+		template<CSimdValue TValue>
+		void simdMultiplyAdd(TValue* dst, const TValue* src, const typename SimdRealType<TValue>::Type& scalar, uint64_t count)
+		{
+			using TReal = typename SimdRealType<TValue>::Type;
+
+			TReal* realDst = reinterpret_cast<TReal*>(dst);
+			const TReal* realSrc = reinterpret_cast<const TReal*>(src);
+			const uint64_t realCount = count * (sizeof(TValue) / sizeof(TReal));
+
+			#ifdef SCP_SIMD_X86
+			switch (getSimdLevel())
+			{
+				case SimdLevel::Avx512: return simdMultiplyAddAvx512(realDst, realSrc, scalar, realCount);
+				case SimdLevel::Avx2: return simdMultiplyAddAvx2(realDst, realSrc, scalar, realCount);
+				case SimdLevel::Sse2: return simdMultiplyAddSse2(realDst, realSrc, scalar, realCount);
+				default: break;
+			}
+			#endif
+
+			for (uint64_t i = 0; i < realCount; ++i)
+			{
+				realDst[i] += realSrc[i] * scalar;
+			}
+		}
+
+		template<CSimdReal TValue>
+		TValue simdDot(const TValue* x, const TValue* y, uint64_t count)
+		{
+			#ifdef SCP_SIMD_X86
+			switch (getSimdLevel())
+			{
+				case SimdLevel::Avx512: return simdDotAvx512(x, y, count);
+				case SimdLevel::Avx2: return simdDotAvx2(x, y, count);
+				case SimdLevel::Sse2: return simdDotSse2(x, y, count);
+				default: break;
+			}
+			#endif
+
+			TValue sum = 0;
+			for (uint64_t i = 0; i < count; ++i)
+			{
+				sum += x[i] * y[i];
+			}
+
+			return sum;
+		}
+
+		template<CSimdReal TValue>
+		SimdGemmKernel<TValue> getSimdGemmKernel()
+		{
+			#ifdef SCP_SIMD_X86
+			switch (getSimdLevel())
+			{
+				case SimdLevel::Avx512: return { 12, 128 / sizeof(TValue), &simdGemmKernelAvx512 };
+				case SimdLevel::Avx2:
+				{
+					if (hasSimdFma())
+					{
+						return { 6, 64 / sizeof(TValue), &simdGemmKernelAvx2 };
+					}
+
+					break;
+				}
+				default: break;
+			}
+			#endif
+
+			return { 0, 0, nullptr };
+		}
+
+		template<CSimdValue TValue> requires CComplex<TValue>
+		uint64_t simdFftRadix2(const TValue* src, uint64_t srcStride, TValue* dst, uint64_t dstStride, const TValue* twiddles, uint64_t count)
+		{
+			using TReal = typename SimdRealType<TValue>::Type;
+
+			const TReal* realSrc = reinterpret_cast<const TReal*>(src);
+			TReal* realDst = reinterpret_cast<TReal*>(dst);
+			const TReal* realTwiddles = reinterpret_cast<const TReal*>(twiddles);
+
+			#ifdef SCP_SIMD_X86
+			switch (getSimdLevel())
+			{
+				case SimdLevel::Avx512: return simdFftRadix2Avx512(realSrc, srcStride, realDst, dstStride, realTwiddles, count);
+				case SimdLevel::Avx2: return simdFftRadix2Avx2(realSrc, srcStride, realDst, dstStride, realTwiddles, count);
+				case SimdLevel::Sse2: return simdFftRadix2Sse2(realSrc, srcStride, realDst, dstStride, realTwiddles, count);
+				default: break;
+			}
+			#endif
+
+			return 0;
+		}
+
+		template<CSimdValue TValue> requires CComplex<TValue>
+		uint64_t simdFftRadix4(const TValue* src, uint64_t srcStride, TValue* dst, uint64_t dstStride, const TValue* twiddles, uint64_t count)
+		{
+			using TReal = typename SimdRealType<TValue>::Type;
+
+			const TReal* realSrc = reinterpret_cast<const TReal*>(src);
+			TReal* realDst = reinterpret_cast<TReal*>(dst);
+			const TReal* realTwiddles = reinterpret_cast<const TReal*>(twiddles);
+
+			#ifdef SCP_SIMD_X86
+			switch (getSimdLevel())
+			{
+				case SimdLevel::Avx512: return simdFftRadix4Avx512(realSrc, srcStride, realDst, dstStride, realTwiddles, count);
+				case SimdLevel::Avx2: return simdFftRadix4Avx2(realSrc, srcStride, realDst, dstStride, realTwiddles, count);
+				case SimdLevel::Sse2: return simdFftRadix4Sse2(realSrc, srcStride, realDst, dstStride, realTwiddles, count);
+				default: break;
+			}
+			#endif
+
+			return 0;
+		}
+
+		template<CSimdValue TValue> requires CComplex<TValue>
+		uint64_t simdFftRadix8(const TValue* src, uint64_t srcStride, TValue* dst, uint64_t dstStride, const TValue* twiddles, uint64_t count)
+		{
+			using TReal = typename SimdRealType<TValue>::Type;
+
+			const TReal* realSrc = reinterpret_cast<const TReal*>(src);
+			TReal* realDst = reinterpret_cast<TReal*>(dst);
+			const TReal* realTwiddles = reinterpret_cast<const TReal*>(twiddles);
+
+			#ifdef SCP_SIMD_X86
+			switch (getSimdLevel())
+			{
+				case SimdLevel::Avx512: return simdFftRadix8Avx512(realSrc, srcStride, realDst, dstStride, realTwiddles, count);
+				case SimdLevel::Avx2: return simdFftRadix8Avx2(realSrc, srcStride, realDst, dstStride, realTwiddles, count);
+				case SimdLevel::Sse2: return simdFftRadix8Sse2(realSrc, srcStride, realDst, dstStride, realTwiddles, count);
+				default: break;
+			}
+			#endif
+
+			return 0;
+		}
+	}
+}
+
+#ifdef SCP_SIMD_X86
+	#undef SCP_SIMD_BINARY_KERNEL
+	#undef SCP_SIMD_SCALAR_KERNEL
+	#undef SCP_SIMD_NEGATE_KERNEL
+	#undef SCP_SIMD_MULTIPLY_ADD_KERNEL
+	#undef SCP_SIMD_DOT_KERNEL
+	#undef SCP_SIMD_KERNELS
+	#undef SCP_SIMD_FFT_KERNELS
+	#undef SCP_SIMD_GEMM_KERNEL
+#endif
@@ -0,0 +1,254 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//! \file
+//! \author Plgrin Marius
+//! \copyright The MIT License (MIT)
+//! \date 2019-2024
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <SciPP/Core/CoreDecl.hpp>
+
+namespace scp
+{
+	namespace _scp
+	{
+		template<typename TValue>
+		constexpr BorrowedTensor<TValue>::BorrowedTensor(const TensorShape& shape, const TValue* values) : Tensor<TValue>()
+		{
+			_shape = shape;
+			_length = shape.getElementCount();
+			_values = const_cast<TValue*>(values);
+			_owner = false;
+		}
+
+		template<typename TValue>
+		constexpr BorrowedTensor<TValue>::~BorrowedTensor()
+		{
+			// Nothing to release, the shape and the values belong to someone else
+			_values = nullptr;
+		}
+	}
+
+	template<typename TValue, uint64_t... Sizes>
+	constexpr StaticTensor<TValue, Sizes...>::StaticTensor() :
+		_values()
+	{
+	}
+
+	template<typename TValue, uint64_t... Sizes>
+	constexpr StaticTensor<TValue, Sizes...>::StaticTensor(const TValue& value)
+	{
+		_values.fill(value);
+	}
+
+	template<typename TValue, uint64_t... Sizes>
+	constexpr StaticTensor<TValue, Sizes...>::StaticTensor(const TValue* values)
+	{
+		std::copy_n(values, elementCount, _values.begin());
+	}
+
+	template<typename TValue, uint64_t... Sizes>
+	constexpr StaticTensor<TValue, Sizes...>::StaticTensor(const std::initializer_list<TValue>& values)
+	{
+		assert(values.size() == elementCount);
+		std::copy_n(values.begin(), elementCount, _values.begin());
+	}
+
+	template<typename TValue, uint64_t... Sizes>
+	constexpr StaticTensor<TValue, Sizes...>::StaticTensor(const Tensor<TValue>& tensor)
+	{
+		operator=(tensor);
+	}
+
+	template<typename TValue, uint64_t... Sizes>
+	template<CTensorExpr TExpr>
+	constexpr StaticTensor<TValue, Sizes...>::StaticTensor(const TExpr& expr)
+	{
+		operator=(expr);
+	}
+
+	template<typename TValue, uint64_t... Sizes>
+	constexpr StaticTensor<TValue, Sizes...>& StaticTensor<TValue, Sizes...>::operator=(const Tensor<TValue>& tensor)
+	{
+		assert(tensor.getOrder() == order);
+		assert(std::equal(_sizes.begin(), _sizes.end(), tensor.getSizes()));
+
+		std::copy_n(tensor.getData(), elementCount, _values.begin());
+
+		return *this;
+	}
+
+	template<typename TValue, uint64_t... Sizes>
+	template<CTensorExpr TExpr>
+	constexpr StaticTensor<TValue, Sizes...>& StaticTensor<TValue, Sizes...>::operator=(const TExpr& expr)
+	{
+		assert(expr.getShape().order == order);
+		assert(std::equal(_sizes.begin(), _sizes.end(), expr.getShape().sizes));
+
+		for (uint64_t i = 0; i < elementCount; ++i)
+		{
+			_values[i] = expr[i];
+		}
+
+		return *this;
+	}
+
+	template<typename TValue, uint64_t... Sizes>
+	constexpr StaticTensor<TValue, Sizes...>::operator const _scp::BorrowedTensor<TValue>() const
+	{
+		return _scp::BorrowedTensor<TValue>(_shape, _values.data());
+	}
+
+	template<typename TValue, uint64_t... Sizes>
+	constexpr TValue* StaticTensor<TValue, Sizes...>::begin()
+	{
+		return _values.data();
+	}
+
+	template<typename TValue, uint64_t... Sizes>
+	constexpr TValue* StaticTensor<TValue, Sizes...>::end()
+	{
+		return _values.data() + elementCount;
+	}
+
+	template<typename TValue, uint64_t... Sizes>
+	constexpr const TValue* StaticTensor<TValue, Sizes...>::begin() const
+	{
+		return _values.data();
+	}
+
+	template<typename TValue, uint64_t... Sizes>
+	constexpr const TValue* StaticTensor<TValue, Sizes...>::end() const
+	{
+		return _values.data() + elementCount;
+	}
+
+	template<typename TValue, uint64_t... Sizes>
+	constexpr TValue& StaticTensor<TValue, Sizes...>::operator[](uint64_t index)
+	{
+		return get(index);
+	}
+
+	template<typename TValue, uint64_t... Sizes>
+	constexpr const TValue& StaticTensor<TValue, Sizes...>::operator[](uint64_t index) const
+	{
+		return get(index);
+	}
+
+	template<typename TValue, uint64_t... Sizes>
+	constexpr TValue& StaticTensor<TValue, Sizes...>::operator[](const std::initializer_list<uint64_t>& indices)
+	{
+		assert(indices.size() == order);
+		return get(indices.begin());
+	}
+
+	template<typename TValue, uint64_t... Sizes>
+	constexpr const TValue& StaticTensor<TValue, Sizes...>::operator[](const std::initializer_list<uint64_t>& indices) const
+	{
+		assert(indices.size() == order);
+		return get(indices.begin());
+	}
+
+	template<typename TValue, uint64_t... Sizes>
+	constexpr const TValue& StaticTensor<TValue, Sizes...>::get(uint64_t index) const
+	{
+		assert(index < elementCount);
+		return _values[index];
+	}
+
+	template<typename TValue, uint64_t... Sizes>
+	constexpr const TValue& StaticTensor<TValue, Sizes...>::get(const uint64_t* indices) const
+	{
+		return _values[getIndex(indices)];
+	}
+
+	template<typename TValue, uint64_t... Sizes>
+	constexpr TValue& StaticTensor<TValue, Sizes...>::get(uint64_t index)
+	{
+		assert(index < elementCount);
+		return _values[index];
+	}
+
+	template<typename TValue, uint64_t... Sizes>
+	constexpr TValue& StaticTensor<TValue, Sizes...>::get(const uint64_t* indices)
+	{
+		return _values[getIndex(indices)];
+	}
+
+	template<typename TValue, uint64_t... Sizes>
+	constexpr void StaticTensor<TValue, Sizes...>::set(uint64_t index, const TValue& value)
+	{
+		get(index) = value;
+	}
+
+	template<typename TValue, uint64_t... Sizes>
+	constexpr void StaticTensor<TValue, Sizes...>::set(const uint64_t* indices, const TValue& value)
+	{
+		get(indices) = value;
+	}
+
+	template<typename TValue, uint64_t... Sizes>
+	constexpr uint64_t StaticTensor<TValue, Sizes...>::getIndex(const uint64_t* indices)
+	{
+		return [&]<uint64_t... Axes>(std::index_sequence<Axes...>)
+		{
+			assert(((indices[Axes] < _sizes[Axes]) && ...));
+			return ((indices[Axes] * _strides[Axes]) + ...);
+		}(std::make_index_sequence<order>());
+	}
+
+	template<typename TValue, uint64_t... Sizes>
+	constexpr void StaticTensor<TValue, Sizes...>::getIndices(uint64_t index, uint64_t* indices)
+	{
+		assert(index < elementCount);
+
+		[&]<uint64_t... Axes>(std::index_sequence<Axes...>)
+		{
+			((indices[Axes] = index / _strides[Axes], index %= _strides[Axes]), ...);
+		}(std::make_index_sequence<order>());
+	}
+
+	template<typename TValue, uint64_t... Sizes>
+	constexpr const TensorShape& StaticTensor<TValue, Sizes...>::getShape()
+	{
+		return _shape;
+	}
+
+	template<typename TValue, uint64_t... Sizes>
+	constexpr uint64_t StaticTensor<TValue, Sizes...>::getOrder()
+	{
+		return order;
+	}
+
+	template<typename TValue, uint64_t... Sizes>
+	constexpr const uint64_t* StaticTensor<TValue, Sizes...>::getSizes()
+	{
+		return _sizes.data();
+	}
+
+	template<typename TValue, uint64_t... Sizes>
+	constexpr uint64_t StaticTensor<TValue, Sizes...>::getSize(uint64_t i)
+	{
+		assert(i < order);
+		return _sizes[i];
+	}
+
+	template<typename TValue, uint64_t... Sizes>
+	constexpr uint64_t StaticTensor<TValue, Sizes...>::getElementCount()
+	{
+		return elementCount;
+	}
+
+	template<typename TValue, uint64_t... Sizes>
+	constexpr TValue* StaticTensor<TValue, Sizes...>::getData()
+	{
+		return _values.data();
+	}
+
+	template<typename TValue, uint64_t... Sizes>
+	constexpr const TValue* StaticTensor<TValue, Sizes...>::getData() const
+	{
+		return _values.data();
+	}
+}
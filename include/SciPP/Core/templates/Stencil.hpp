@@ -0,0 +1,196 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//! \file
+//! \author Plgrin Marius
+//! \copyright The MIT License (MIT)
+//! \date 2019-2024
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <SciPP/Core/CoreDecl.hpp>
+
+namespace scp
+{
+	template<BorderBehaviour BBehaviour, CStencilOffset... TOffsets, typename TValue, typename TFunc, typename... TInputValues>
+	constexpr void stencil(Tensor<TValue>& output, const TFunc& func, const Tensor<TInputValues>&... inputs)
+	{
+		static_assert(sizeof...(TOffsets) != 0, "A stencil needs at least one offset.");
+		static_assert(sizeof...(TInputValues) != 0, "A stencil needs at least one input.");
+
+		constexpr uint64_t order = std::max({ TOffsets::order... });
+		constexpr uint64_t pointCount = sizeof...(TOffsets);
+
+		static_assert(order != 0 && ((TOffsets::order == order) && ...), "All offsets must have the same order.");
+
+		constexpr std::array<std::array<int64_t, order>, pointCount> offsets = { TOffsets::indices... };
+
+		// How far the stencil reaches on each side of each axis
+
+		constexpr std::array<int64_t, order> lowReach = [&]()
+		{
+			std::array<int64_t, order> reach = {};
+			for (const std::array<int64_t, order>& offset : offsets)
+			{
+				for (uint64_t i = 0; i < order; ++i)
+				{
+					reach[i] = std::max(reach[i], -offset[i]);
+				}
+			}
+
+			return reach;
+		}();
+
+		constexpr std::array<int64_t, order> highReach = [&]()
+		{
+			std::array<int64_t, order> reach = {};
+			for (const std::array<int64_t, order>& offset : offsets)
+			{
+				for (uint64_t i = 0; i < order; ++i)
+				{
+					reach[i] = std::max(reach[i], offset[i]);
+				}
+			}
+
+			return reach;
+		}();
+
+		const TensorShape& shape = output.getShape();
+		const uint64_t* sizes = shape.sizes;
+
+		assert(shape.order == order);
+		assert(((inputs.getOrder() == order && std::equal(sizes, sizes + order, inputs.getSizes())) && ...));
+
+		// Taken once, before the tasks: with copy-on-write, the first non-const access may give output its own values
+
+		TValue* outputData = output.getData();
+
+		assert(((static_cast<const void*>(inputs.getData()) != static_cast<const void*>(outputData)) && ...));
+
+		std::array<int64_t, order> strides;
+		int64_t stride = 1;
+		for (uint64_t i = order; i-- > 0;)
+		{
+			strides[i] = stride;
+			stride *= static_cast<int64_t>(sizes[i]);
+		}
+
+		std::array<int64_t, pointCount> linearOffsets;
+		for (uint64_t p = 0; p < pointCount; ++p)
+		{
+			linearOffsets[p] = 0;
+			for (uint64_t i = 0; i < order; ++i)
+			{
+				linearOffsets[p] += offsets[p][i] * strides[i];
+			}
+		}
+
+		// Calls func with, for each input, its values at each offset. load(input, p) returns the value of input at the
+		// p-th offset; p being a constant, the loads are unrolled.
+
+		const auto evaluate = [&](const auto& load) -> TValue
+		{
+			return [&]<uint64_t... Points>(std::index_sequence<Points...>)
+			{
+				const auto loadInput = [&](const auto& input)
+				{
+					return std::make_tuple(load(input, Points)...);
+				};
+
+				return std::apply(func, std::tuple_cat(loadInput(inputs)...));
+			}(std::make_index_sequence<pointCount>());
+		};
+
+		// The rows are cut in tiles. In each tile, the elements whose neighbours may be out of the tensor are computed
+		// one by one with wrapped indices, and the interior span directly with the linear offsets.
+
+		constexpr uint64_t tileWidth = 256;
+		const uint64_t rowSize = sizes[order - 1];
+		const uint64_t rowCount = shape.getElementCount() / rowSize;
+		const uint64_t tilesPerRow = (rowSize + tileWidth - 1) / tileWidth;
+		const uint64_t lowRowReach = static_cast<uint64_t>(lowReach[order - 1]);
+		const uint64_t highRowReach = static_cast<uint64_t>(highReach[order - 1]);
+
+		_scp::parallelFor(rowCount * tilesPerRow, std::min(rowSize, tileWidth) * pointCount * sizeof...(inputs), [&](uint64_t begin, uint64_t end)
+		{
+			std::array<uint64_t, order> indices;
+			std::array<int64_t, pointCount> positions;
+
+			const auto computeBorderElement = [&](uint64_t index)
+			{
+				indices[order - 1] = index % rowSize;
+
+				for (uint64_t p = 0; p < pointCount; ++p)
+				{
+					positions[p] = 0;
+					for (uint64_t i = 0; i < order; ++i)
+					{
+						const int64_t size = static_cast<int64_t>(sizes[i]);
+						int64_t position = static_cast<int64_t>(indices[i]) + offsets[p][i];
+
+						if (position < 0 || position >= size)
+						{
+							if constexpr (BBehaviour == BorderBehaviour::Zero)
+							{
+								positions[p] = -1;
+								break;
+							}
+							else if constexpr (BBehaviour == BorderBehaviour::Continuous)
+							{
+								position = std::clamp<int64_t>(position, 0, size - 1);
+							}
+							else if constexpr (BBehaviour == BorderBehaviour::Periodic)
+							{
+								position = (position % size + size) % size;
+							}
+						}
+
+						positions[p] += position * strides[i];
+					}
+				}
+
+				outputData[index] = evaluate([&](const auto& input, uint64_t p)
+				{
+					using TInput = std::remove_cvref_t<decltype(*input.getData())>;
+					return positions[p] < 0 ? TInput(0) : input.getData()[positions[p]];
+				});
+			};
+
+			for (uint64_t tile = begin; tile < end; ++tile)
+			{
+				const uint64_t rowStart = (tile / tilesPerRow) * rowSize;
+				const uint64_t tileBegin = (tile % tilesPerRow) * tileWidth;
+				const uint64_t tileEnd = std::min(tileBegin + tileWidth, rowSize);
+
+				shape.getIndices(rowStart, indices.data());
+
+				bool interiorRow = true;
+				for (uint64_t i = 0; i < order - 1; ++i)
+				{
+					interiorRow = interiorRow && indices[i] >= static_cast<uint64_t>(lowReach[i]) && indices[i] + highReach[i] < sizes[i];
+				}
+
+				const uint64_t interiorBegin = interiorRow ? std::clamp(lowRowReach, tileBegin, tileEnd) : tileEnd;
+				const uint64_t interiorEnd = interiorRow ? std::clamp(rowSize - std::min(highRowReach, rowSize), interiorBegin, tileEnd) : tileEnd;
+
+				for (uint64_t x = tileBegin; x < interiorBegin; ++x)
+				{
+					computeBorderElement(rowStart + x);
+				}
+
+				for (uint64_t x = interiorBegin; x < interiorEnd; ++x)
+				{
+					const int64_t index = static_cast<int64_t>(rowStart + x);
+					outputData[index] = evaluate([&](const auto& input, uint64_t p)
+					{
+						return input.getData()[index + linearOffsets[p]];
+					});
+				}
+
+				for (uint64_t x = interiorEnd; x < tileEnd; ++x)
+				{
+					computeBorderElement(rowStart + x);
+				}
+			}
+		});
+	}
+}
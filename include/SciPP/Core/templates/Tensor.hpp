@@ -108,6 +108,24 @@ namespace scp
 				}
 			}
 		}
+
+		template<typename TValue>
+		constexpr void multiplyAdd(TValue* dst, const TValue* src, const TValue& scalar, uint64_t count)
+		{
+			if constexpr (CSimdReal<TValue>)
+			{
+				if !consteval
+				{
+					simdMultiplyAdd(dst, src, scalar, count);
+					return;
+				}
+			}
+
+			for (uint64_t i = 0; i < count; ++i)
+			{
+				dst[i] += src[i] * scalar;
+			}
+		}
 	}
 
 	template<typename TValue>
@@ -136,12 +154,21 @@ namespace scp
 		return createAroundMemory(sizes.size(), sizes.begin(), memory);
 	}
 
+	template<typename TValue>
+	constexpr Tensor<TValue>* Tensor<TValue>::createAroundMemory(const TensorView<TValue>& view)
+	{
+		assert(view.isContiguous());
+		return createAroundMemory(view.getOrder(), view.getSizes(), view.getData());
+	}
+
 	template<typename TValue>
 	constexpr Tensor<TValue>::Tensor() :
 		_shape{ 0, nullptr },
 		_length(0),
 		_values(nullptr),
-		_owner(true)
+		_owner(true),
+		_allocator(nullptr),
+		_references(nullptr)
 	{
 	}
 
@@ -149,12 +176,15 @@ namespace scp
 	constexpr Tensor<TValue>::Tensor(uint64_t order, const uint64_t* sizes) :
 		_shape{ order, new uint64_t[order] },
 		_length(std::accumulate(sizes, sizes + order, 1, std::multiplies<uint64_t>())),
-		_values(new TValue[_length]),
-		_owner(true)
+		_values(nullptr),
+		_owner(true),
+		_allocator(nullptr),
+		_references(nullptr)
 	{
 		assert(order != 0);
 		assert(std::find(sizes, sizes + order, 0) == sizes + order);
 
+		_allocateValues();
 		std::copy_n(sizes, _shape.order, _shape.sizes);
 	}
 
@@ -202,11 +232,38 @@ namespace scp
 	constexpr Tensor<TValue>::Tensor(const Tensor<TValue>& tensor) :
 		_shape{ tensor._shape.order, new uint64_t[tensor._shape.order] },
 		_length(tensor._length),
-		_values(new TValue[tensor._length]),
-		_owner(true)
+		_values(nullptr),
+		_owner(true),
+		_allocator(nullptr),
+		_references(nullptr)
 	{
 		std::copy_n(tensor._shape.sizes, tensor._shape.order, _shape.sizes);
-		std::copy_n(tensor._values, _length, _values);
+
+		if consteval
+		{
+			_allocateValues();
+			std::copy_n(tensor._values, _length, _values);
+		}
+		else
+		{
+			if (tensorCopyOnWrite && tensor._references)
+			{
+				tensor._references->fetch_add(1, std::memory_order_relaxed);
+
+				_values = tensor._values;
+				_allocator = tensor._allocator;
+				_references = tensor._references;
+
+				_scp::countTensorSharedCopy();
+			}
+			else
+			{
+				_allocateValues();
+				std::copy_n(tensor._values, _length, _values);
+
+				_scp::countTensorDeepCopy(_shape, _length * sizeof(TValue), false);
+			}
+		}
 	}
 
 	template<typename TValue>
@@ -214,25 +271,82 @@ namespace scp
 		_shape(tensor._shape),
 		_length(tensor._length),
 		_values(tensor._values),
-		_owner(tensor._owner)
+		_owner(tensor._owner),
+		_allocator(tensor._allocator),
+		_references(tensor._references)
 	{
 		tensor._values = nullptr;
+		tensor._allocator = nullptr;
+		tensor._references = nullptr;
+	}
+
+	template<typename TValue>
+	template<CTensorExpr TExpr>
+	constexpr Tensor<TValue>::Tensor(const TExpr& expr) : Tensor<TValue>(expr.getShape().order, expr.getShape().sizes)
+	{
+		_scp::parallelFor(_length, [&](uint64_t begin, uint64_t end)
+		{
+			TValue* values = _values + begin;
+			for (uint64_t i = begin; i < end; ++i, ++values)
+			{
+				*values = expr[i];
+			}
+		});
 	}
 
 	template<typename TValue>
 	constexpr Tensor<TValue>& Tensor<TValue>::operator=(const Tensor<TValue>& tensor)
 	{
-		if (_shape.order != tensor._shape.order || _length != tensor._length)
+		if (this == &tensor)
+		{
+			return *this;
+		}
+
+		if !consteval
+		{
+			// Unshareable values may still be written through escaped pointers, so they are overwritten in place
+
+			if (tensorCopyOnWrite && tensor._references && _references && _owner)
+			{
+				if (_values != tensor._values)
+				{
+					tensor._references->fetch_add(1, std::memory_order_relaxed);
+					_deallocateValues();
+
+					_values = tensor._values;
+					_allocator = tensor._allocator;
+					_references = tensor._references;
+				}
+
+				if (_shape.order != tensor._shape.order)
+				{
+					delete[] _shape.sizes;
+					_shape.order = tensor._shape.order;
+					_shape.sizes = new uint64_t[_shape.order];
+				}
+
+				_length = tensor._length;
+				std::copy_n(tensor._shape.sizes, _shape.order, _shape.sizes);
+
+				_scp::countTensorSharedCopy();
+
+				return *this;
+			}
+		}
+
+		// Shared values are about to be overwritten entirely, so they are replaced rather than duplicated
+
+		if (_shape.order != tensor._shape.order || _length != tensor._length || _isShared())
 		{
 			assert(_owner);
 
 			delete[] _shape.sizes;
-			delete[] _values;
+			_deallocateValues();
 
 			_shape.order = tensor._shape.order;
 			_length = std::accumulate(tensor._shape.sizes, tensor._shape.sizes + tensor._shape.order, 1, std::multiplies<uint64_t>());
 			_shape.sizes = new uint64_t[_shape.order];
-			_values = new TValue[_length];
+			_allocateValues();
 			_owner = true;
 
 			std::copy_n(tensor._shape.sizes, _shape.order, _shape.sizes);
@@ -244,6 +358,11 @@ namespace scp
 
 		std::copy_n(tensor._values, _length, _values);
 
+		if !consteval
+		{
+			_scp::countTensorDeepCopy(_shape, _length * sizeof(TValue), false);
+		}
+
 		return *this;
 	}
 
@@ -256,15 +375,70 @@ namespace scp
 		}
 
 		delete[] _shape.sizes;
-		delete[] _values;
+		_deallocateValues();
 
 		_shape.order = tensor._shape.order;
 		_length = tensor._length;
 		_shape.sizes = tensor._shape.sizes;
 		_values = tensor._values;
 		_owner = tensor._owner;
+		_allocator = tensor._allocator;
+		_references = tensor._references;
 		
 		tensor._values = nullptr;
+		tensor._allocator = nullptr;
+		tensor._references = nullptr;
+
+		return *this;
+	}
+
+	template<typename TValue>
+	template<CTensorExpr TExpr>
+	constexpr Tensor<TValue>& Tensor<TValue>::operator=(const TExpr& expr)
+	{
+		const TensorShape& shape = expr.getShape();
+
+		// The expression is evaluated elementwise in place, so it can reference the values of *this at the same indices.
+		// Otherwise, as through a transposed view, it is evaluated beforehand.
+
+		if (_scp::toTensorExpr(expr).aliases(_values, _shape, static_cast<const int64_t*>(nullptr)))
+		{
+			return operator=(Tensor<TValue>(expr));
+		}
+
+		if (_shape.order != shape.order || _length != expr.getElementCount())
+		{
+			assert(_owner);
+
+			delete[] _shape.sizes;
+			_deallocateValues();
+
+			_shape.order = shape.order;
+			_length = expr.getElementCount();
+			_shape.sizes = new uint64_t[_shape.order];
+			_allocateValues();
+			_owner = true;
+
+			std::copy_n(shape.sizes, _shape.order, _shape.sizes);
+		}
+		else
+		{
+			if (!std::equal(_shape.sizes, _shape.sizes + _shape.order, shape.sizes))
+			{
+				std::copy_n(shape.sizes, _shape.order, _shape.sizes);
+			}
+
+			_detachValues();
+		}
+
+		_scp::parallelFor(_length, [&](uint64_t begin, uint64_t end)
+		{
+			TValue* values = _values + begin;
+			for (uint64_t i = begin; i < end; ++i, ++values)
+			{
+				*values = expr[i];
+			}
+		});
 
 		return *this;
 	}
@@ -275,14 +449,28 @@ namespace scp
 		assert(_shape.order == tensor._shape.order);
 		assert(std::equal(_shape.sizes, _shape.sizes + _shape.order, tensor._shape.sizes));
 
-		TValue* values = _values;
-		TValue* tensorValues = tensor._values;
-		const TValue* const valuesEnd = _values + _length;
-		
-		for (; values != valuesEnd; ++values, ++tensorValues)
+		_detachValues();
+
+		_scp::parallelFor(_length, [&](uint64_t begin, uint64_t end)
 		{
-			*values += *tensorValues;
-		}
+			if constexpr (_scp::CSimdValue<TValue>)
+			{
+				if !consteval
+				{
+					_scp::simdAdd(_values + begin, tensor._values + begin, end - begin);
+					return;
+				}
+			}
+
+			TValue* values = _values + begin;
+			const TValue* tensorValues = tensor._values + begin;
+			const TValue* const valuesEnd = _values + end;
+
+			for (; values != valuesEnd; ++values, ++tensorValues)
+			{
+				*values += *tensorValues;
+			}
+		});
 
 		return *this;
 	}
@@ -293,15 +481,81 @@ namespace scp
 		assert(_shape.order == tensor._shape.order);
 		assert(std::equal(_shape.sizes, _shape.sizes + _shape.order, tensor._shape.sizes));
 
-		TValue* values = _values;
-		TValue* tensorValues = tensor._values;
-		const TValue* const valuesEnd = _values + _length;
+		_detachValues();
 
-		for (; values != valuesEnd; ++values, ++tensorValues)
+		_scp::parallelFor(_length, [&](uint64_t begin, uint64_t end)
 		{
-			*values -= *tensorValues;
+			if constexpr (_scp::CSimdValue<TValue>)
+			{
+				if !consteval
+				{
+					_scp::simdSub(_values + begin, tensor._values + begin, end - begin);
+					return;
+				}
+			}
+
+			TValue* values = _values + begin;
+			const TValue* tensorValues = tensor._values + begin;
+			const TValue* const valuesEnd = _values + end;
+
+			for (; values != valuesEnd; ++values, ++tensorValues)
+			{
+				*values -= *tensorValues;
+			}
+		});
+
+		return *this;
+	}
+
+	template<typename TValue>
+	template<CTensorExpr TExpr>
+	constexpr Tensor<TValue>& Tensor<TValue>::operator+=(const TExpr& expr)
+	{
+		assert(_shape.order == expr.getShape().order);
+		assert(std::equal(_shape.sizes, _shape.sizes + _shape.order, expr.getShape().sizes));
+
+		if (_scp::toTensorExpr(expr).aliases(_values, _shape, static_cast<const int64_t*>(nullptr)))
+		{
+			return operator+=(Tensor<TValue>(expr));
 		}
 
+		_detachValues();
+
+		_scp::parallelFor(_length, [&](uint64_t begin, uint64_t end)
+		{
+			TValue* values = _values + begin;
+			for (uint64_t i = begin; i < end; ++i, ++values)
+			{
+				*values += expr[i];
+			}
+		});
+
+		return *this;
+	}
+
+	template<typename TValue>
+	template<CTensorExpr TExpr>
+	constexpr Tensor<TValue>& Tensor<TValue>::operator-=(const TExpr& expr)
+	{
+		assert(_shape.order == expr.getShape().order);
+		assert(std::equal(_shape.sizes, _shape.sizes + _shape.order, expr.getShape().sizes));
+
+		if (_scp::toTensorExpr(expr).aliases(_values, _shape, static_cast<const int64_t*>(nullptr)))
+		{
+			return operator-=(Tensor<TValue>(expr));
+		}
+
+		_detachValues();
+
+		_scp::parallelFor(_length, [&](uint64_t begin, uint64_t end)
+		{
+			TValue* values = _values + begin;
+			for (uint64_t i = begin; i < end; ++i, ++values)
+			{
+				*values -= expr[i];
+			}
+		});
+
 		return *this;
 	}
 
@@ -309,13 +563,37 @@ namespace scp
 	template<typename TScalar>
 	constexpr Tensor<TValue>& Tensor<TValue>::operator*=(const TScalar& scalar)
 	{
-		TValue* values = _values;
-		const TValue* const valuesEnd = _values + _length;
+		_detachValues();
 
-		for (; values != valuesEnd; ++values)
+		_scp::parallelFor(_length, [&](uint64_t begin, uint64_t end)
 		{
-			*values *= scalar;
-		}
+			if constexpr (_scp::CSimdValue<TValue>)
+			{
+				using TReal = typename _scp::SimdRealType<TValue>::Type;
+
+				if !consteval
+				{
+					if constexpr (std::same_as<TScalar, TReal> || std::integral<TScalar>)
+					{
+						_scp::simdScale(_values + begin, static_cast<TReal>(scalar), end - begin);
+						return;
+					}
+					else if constexpr (std::same_as<TScalar, TValue> && CComplex<TValue>)
+					{
+						_scp::simdScale(_values + begin, scalar, end - begin);
+						return;
+					}
+				}
+			}
+
+			TValue* values = _values + begin;
+			const TValue* const valuesEnd = _values + end;
+
+			for (; values != valuesEnd; ++values)
+			{
+				*values *= scalar;
+			}
+		});
 
 		return *this;
 	}
@@ -324,13 +602,32 @@ namespace scp
 	template<typename TScalar>
 	constexpr Tensor<TValue>& Tensor<TValue>::operator/=(const TScalar& scalar)
 	{
-		TValue* values = _values;
-		const TValue* const valuesEnd = _values + _length;
+		_detachValues();
 
-		for (; values != valuesEnd; ++values)
+		_scp::parallelFor(_length, [&](uint64_t begin, uint64_t end)
 		{
-			*values /= scalar;
-		}
+			if constexpr (_scp::CSimdValue<TValue>)
+			{
+				using TReal = typename _scp::SimdRealType<TValue>::Type;
+
+				if !consteval
+				{
+					if constexpr (std::same_as<TScalar, TReal> || std::integral<TScalar>)
+					{
+						_scp::simdDivide(_values + begin, static_cast<TReal>(scalar), end - begin);
+						return;
+					}
+				}
+			}
+
+			TValue* values = _values + begin;
+			const TValue* const valuesEnd = _values + end;
+
+			for (; values != valuesEnd; ++values)
+			{
+				*values /= scalar;
+			}
+		});
 
 		return *this;
 	}
@@ -338,13 +635,27 @@ namespace scp
 	template<typename TValue>
 	constexpr Tensor<TValue>& Tensor<TValue>::negate()
 	{
-		TValue* values = _values;
-		const TValue* const valuesEnd = _values + _length;
+		_detachValues();
 
-		for (; values != valuesEnd; ++values)
+		_scp::parallelFor(_length, [&](uint64_t begin, uint64_t end)
 		{
-			*values = -(*values);
-		}
+			if constexpr (_scp::CSimdValue<TValue>)
+			{
+				if !consteval
+				{
+					_scp::simdNegate(_values + begin, end - begin);
+					return;
+				}
+			}
+
+			TValue* values = _values + begin;
+			const TValue* const valuesEnd = _values + end;
+
+			for (; values != valuesEnd; ++values)
+			{
+				*values = -(*values);
+			}
+		});
 
 		return *this;
 	}
@@ -356,24 +667,27 @@ namespace scp
 		assert(std::equal(tensorA._shape.sizes, tensorA._shape.sizes + tensorA._shape.order, _shape.sizes));
 		assert(std::equal(tensorB._shape.sizes, tensorB._shape.sizes + tensorB._shape.order, _shape.sizes + tensorA._shape.order));
 
-		const uint64_t lengthA = tensorA._length;
+		_detachValues();
 
-		TValue* values = _values;
+		_scp::parallelFor(tensorA._length, tensorB._length, [&](uint64_t begin, uint64_t end)
+		{
+			TValue* values = _values + begin * tensorB._length;
 
-		const TValue* valuesA = tensorA._values;
-		const TValue* const valuesAEnd = valuesA + tensorA._length;
+			const TValue* valuesA = tensorA._values + begin;
+			const TValue* const valuesAEnd = tensorA._values + end;
 
-		const TValue* valuesB = tensorB._values;
-		const TValue* const valuesBEnd = valuesB + tensorB._length;
+			const TValue* valuesB = tensorB._values;
+			const TValue* const valuesBEnd = valuesB + tensorB._length;
 
-		for (; valuesA != valuesAEnd; ++valuesA)
-		{
-			valuesB = tensorB._values;
-			for (; valuesB != valuesBEnd; ++valuesB, ++values)
+			for (; valuesA != valuesAEnd; ++valuesA)
 			{
-				*values = (*valuesA) * (*valuesB);
+				valuesB = tensorB._values;
+				for (; valuesB != valuesBEnd; ++valuesB, ++values)
+				{
+					*values = (*valuesA) * (*valuesB);
+				}
 			}
-		}
+		});
 	}
 
 	template<typename TValue>
@@ -382,41 +696,92 @@ namespace scp
 		assert(_shape.order == tensor._shape.order);
 		assert(std::equal(_shape.sizes, _shape.sizes + _shape.order, tensor._shape.sizes));
 
-		TValue* values = _values;
-		TValue* tensorValues = tensor._values;
-		const TValue* const valuesEnd = _values + _length;
+		_detachValues();
 
-		for (; values != valuesEnd; ++values, ++tensorValues)
+		_scp::parallelFor(_length, [&](uint64_t begin, uint64_t end)
 		{
-			*values *= *tensorValues;
-		}
+			if constexpr (_scp::CSimdValue<TValue>)
+			{
+				if !consteval
+				{
+					_scp::simdMultiply(_values + begin, tensor._values + begin, end - begin);
+					return;
+				}
+			}
+
+			TValue* values = _values + begin;
+			const TValue* tensorValues = tensor._values + begin;
+			const TValue* const valuesEnd = _values + end;
+
+			for (; values != valuesEnd; ++values, ++tensorValues)
+			{
+				*values *= *tensorValues;
+			}
+		});
 	}
 
 	template<typename TValue>
 	constexpr void Tensor<TValue>::fft()
 	{
+		_detachValues();
+
 		if constexpr (CComplex<TValue>)
 		{
-			TValue** bases = new TValue*[_shape.order];
-			for (uint64_t i = 0; i < _shape.order; ++i)
+			if consteval
 			{
-				bases[i] = new TValue[_shape.sizes[i]];
+				FftPlan<TValue>(_shape.order, _shape.sizes).forward(_values);
+			}
+			else
+			{
+				FftPlan<TValue>::getCached(_shape).forward(_values);
+			}
+		}
+		else
+		{
+			assert(false);
+		}
+	}
 
-				TValue x = std::exp(TValue(0, -2 * std::numbers::pi / _shape.sizes[i]));
-				bases[i][0] = 1;
-				for (uint64_t j = 1; j < _shape.sizes[i]; ++j)
-				{
-					bases[i][j] = x * bases[i][j - 1];
-				}
+	template<typename TValue>
+	constexpr void Tensor<TValue>::ifft()
+	{
+		_detachValues();
+
+		if constexpr (CComplex<TValue>)
+		{
+			if consteval
+			{
+				FftPlan<TValue>(_shape.order, _shape.sizes).backward(_values);
+			}
+			else
+			{
+				FftPlan<TValue>::getCached(_shape).backward(_values);
 			}
+		}
+		else
+		{
+			assert(false);
+		}
+	}
 
-			_ndCooleyTukey(_values, _shape.order, bases);
+	template<typename TValue>
+	template<CComplex TComplex>
+	constexpr void Tensor<TValue>::rfft(Tensor<TComplex>& spectrum) const
+	{
+		if constexpr (std::same_as<TComplex, std::complex<TValue>>)
+		{
+			assert(spectrum.getOrder() == _shape.order);
+			assert(std::equal(_shape.sizes, _shape.sizes + _shape.order - 1, spectrum.getSizes()));
+			assert(spectrum.getSize(_shape.order - 1) == _shape.sizes[_shape.order - 1] / 2 + 1);
 
-			for (uint64_t i = 0; i < _shape.order; ++i)
+			if consteval
 			{
-				delete[] bases[i];
+				RealFftPlan<TValue>(_shape.order, _shape.sizes).forward(_values, spectrum.getData());
+			}
+			else
+			{
+				RealFftPlan<TValue>::getCached(_shape).forward(_values, spectrum.getData());
 			}
-			delete[] bases;
 		}
 		else
 		{
@@ -425,111 +790,471 @@ namespace scp
 	}
 
 	template<typename TValue>
-	constexpr void Tensor<TValue>::ifft()
+	template<std::floating_point TReal>
+	constexpr void Tensor<TValue>::irfft(Tensor<TReal>& output) const
 	{
-		if constexpr (CComplex<TValue>)
+		if constexpr (std::same_as<TValue, std::complex<TReal>>)
 		{
-			TValue** bases = new TValue * [_shape.order];
-			for (uint64_t i = 0; i < _shape.order; ++i)
+			assert(output.getOrder() == _shape.order);
+			assert(std::equal(_shape.sizes, _shape.sizes + _shape.order - 1, output.getSizes()));
+			assert(_shape.sizes[_shape.order - 1] == output.getSize(_shape.order - 1) / 2 + 1);
+
+			if consteval
+			{
+				RealFftPlan<TReal>(output.getOrder(), output.getSizes()).backward(_values, output.getData());
+			}
+			else
+			{
+				RealFftPlan<TReal>::getCached(output.getShape()).backward(_values, output.getData());
+			}
+		}
+		else
+		{
+			assert(false);
+		}
+	}
+
+	template<typename TValue>
+	template<BorderBehaviour BBehaviour>
+	constexpr void Tensor<TValue>::convolution(const Tensor<TValue>& kernel)
+	{
+		assert(_shape.order == kernel._shape.order);
+		
+		// Check that the kernel's sizes are odd
+		for (uint64_t i = 0; i < _shape.order; i++)
+		{
+			assert(kernel._shape.sizes[i] & 1);
+			assert(kernel._shape.sizes[i] <= _shape.sizes[i]);
+		}
+
+		_detachValues();
+
+		// Rank-1 kernels are applied one axis at a time, and large kernels go through the spectrum when the border
+		// behaviour allows it. Measured against a tap of the direct loop, the three transforms of n padded elements
+		// cost about 6.n.log2(n) and a tap of a separable pass about a quarter.
+
+		if constexpr (std::floating_point<TValue> || CComplex<TValue>)
+		{
+			if !consteval
+			{
+				const uint64_t directCost = _length * kernel._length;
+
+				uint64_t fftCost = directCost;
+				if constexpr (BBehaviour != BorderBehaviour::Continuous)
+				{
+					uint64_t paddedLength = 1;
+					for (uint64_t i = 0; i < _shape.order; ++i)
+					{
+						paddedLength *= (BBehaviour == BorderBehaviour::Periodic) ? _shape.sizes[i] : _scp::fftFastSize(_shape.sizes[i] + kernel._shape.sizes[i] / 2);
+					}
+
+					fftCost = 6 * paddedLength * std::bit_width(paddedLength);
+				}
+
+				const uint64_t factorsLength = std::accumulate(kernel._shape.sizes, kernel._shape.sizes + _shape.order, uint64_t(0));
+
+				_scp::ScratchBuffer<TValue> factorValues(factorsLength);
+				_scp::ScratchBuffer<TValue*> factors(_shape.order);
+				factors[0] = factorValues.getData();
+				for (uint64_t i = 1; i < _shape.order; ++i)
+				{
+					factors[i] = factors[i - 1] + kernel._shape.sizes[i - 1];
+				}
+
+				if (_shape.order > 1 && kernel._separateKernel(factors.getData()))
+				{
+					const uint64_t separableCost = _length * factorsLength / 4;
+					if (separableCost <= fftCost)
+					{
+						_separableConvolution<BBehaviour>(factors.getData(), kernel._shape.sizes);
+						return;
+					}
+				}
+
+				if (fftCost < directCost)
+				{
+					_fftConvolution<BBehaviour>(kernel);
+					return;
+				}
+			}
+		}
+		
+		// The input is copied in the scratch arena and seen as a tensor, its values being overwritten during the pass
+
+		_scp::ScratchBuffer<TValue> copy(_length);
+		std::copy_n(_values, _length, copy.getData());
+		const _scp::BorrowedTensor<TValue> borrowed(_shape, copy.getData());
+		const Tensor<TValue>& tensor = borrowed;
+
+		// Compute offset (to center the kernel), and the flat offsets of the kernel's elements, valid wherever the
+		// kernel does not cross a border
+
+		const uint64_t order = _shape.order;
+		int64_t* offset = reinterpret_cast<int64_t*>(alloca(order * sizeof(int64_t)));
+		int64_t* strides = reinterpret_cast<int64_t*>(alloca(order * sizeof(int64_t)));
+
+		int64_t stride = 1;
+		for (uint64_t i = order; i-- > 0;)
+		{
+			offset[i] = static_cast<int64_t>(kernel._shape.sizes[i] / 2);
+			strides[i] = stride;
+			stride *= static_cast<int64_t>(_shape.sizes[i]);
+		}
+
+		int64_t centerOffset = 0;
+		for (uint64_t i = 0; i < order; ++i)
+		{
+			centerOffset += offset[i] * strides[i];
+		}
+
+		_scp::ScratchBuffer<int64_t> kernelOffsets(kernel._length);
+		kernel._shape.forEach(0, kernel._length, strides, [&](const uint64_t*, uint64_t kernelIndex, int64_t kernelOffset)
+		{
+			kernelOffsets[kernelIndex] = centerOffset - kernelOffset;
+		});
+
+		// The rows are cut in tiles. In each tile, the elements closer than half the kernel to a border are computed one
+		// by one, and the interior span is computed one kernel element at a time without any border check.
+
+		constexpr uint64_t tileWidth = 256;
+		const uint64_t rowSize = _shape.sizes[order - 1];
+		const uint64_t rowOffset = static_cast<uint64_t>(offset[order - 1]);
+		const uint64_t tilesPerRow = (rowSize + tileWidth - 1) / tileWidth;
+
+		_scp::parallelFor((_length / rowSize) * tilesPerRow, std::min(rowSize, tileWidth) * kernel._length, [&](uint64_t begin, uint64_t end)
+		{
+			uint64_t* indices = reinterpret_cast<uint64_t*>(alloca(order * sizeof(uint64_t)));
+			int64_t* offsetedIndices = reinterpret_cast<int64_t*>(alloca(order * sizeof(int64_t)));
+
+			const auto computeBorderElement = [&](uint64_t index)
+			{
+				_shape.getIndices(index, indices);
+				TValue value = 0;
+
+				// For each element of the kernel
+				kernel._shape.forEach([&](const uint64_t* kernelIndices, uint64_t kernelIndex)
+				{
+					bool setToZero = false;
+
+					int64_t* itOffsetedIndices = offsetedIndices;
+					const uint64_t* itSizes = _shape.sizes;
+					const int64_t* itOffset = offset;
+					const uint64_t* itIndices = indices;
+					const uint64_t* itKernelIndices = kernelIndices;
+
+					// Compute the corresponding indices to poll
+					for (uint64_t k = 0; k < order; ++k, ++itKernelIndices, ++itOffsetedIndices, ++itSizes, ++itOffset, ++itIndices)
+					{
+						*itOffsetedIndices = static_cast<int64_t>(*itIndices) + *itOffset - static_cast<int64_t>(*itKernelIndices);
+
+						if constexpr (BBehaviour == BorderBehaviour::Zero)
+						{
+							if (*itOffsetedIndices < 0 || *itOffsetedIndices >= *itSizes)
+							{
+								setToZero = true;
+								break;
+							}
+						}
+						else if constexpr (BBehaviour == BorderBehaviour::Continuous)
+						{
+							*itOffsetedIndices = std::clamp<int64_t>(*itOffsetedIndices, 0, *itSizes - 1);
+						}
+						else if constexpr (BBehaviour == BorderBehaviour::Periodic)
+						{
+							*itOffsetedIndices = (*itOffsetedIndices + *itSizes) % *itSizes;
+						}
+					}
+
+					// Add the product to the result
+					if (!setToZero)
+					{
+						value += tensor.get(reinterpret_cast<uint64_t*>(offsetedIndices)) * kernel.get(kernelIndex);
+					}
+				});
+
+				_values[index] = value;
+			};
+
+			for (uint64_t tile = begin; tile < end; ++tile)
 			{
-				bases[i] = new TValue[_shape.sizes[i]];
+				const uint64_t rowStart = (tile / tilesPerRow) * rowSize;
+				const uint64_t tileBegin = (tile % tilesPerRow) * tileWidth;
+				const uint64_t tileEnd = std::min(tileBegin + tileWidth, rowSize);
+
+				_shape.getIndices(rowStart, indices);
 
-				TValue x = std::exp(TValue(0, 2 * std::numbers::pi / _shape.sizes[i]));
-				bases[i][0] = 1;
-				for (uint64_t j = 1; j < _shape.sizes[i]; ++j)
+				bool interiorRow = true;
+				for (uint64_t i = 0; i < order - 1; ++i)
 				{
-					bases[i][j] = x * bases[i][j - 1];
+					interiorRow = interiorRow && indices[i] >= static_cast<uint64_t>(offset[i]) && indices[i] + offset[i] < _shape.sizes[i];
+				}
+
+				const uint64_t interiorBegin = interiorRow ? std::clamp(rowOffset, tileBegin, tileEnd) : tileEnd;
+				const uint64_t interiorEnd = interiorRow ? std::clamp(rowSize - rowOffset, interiorBegin, tileEnd) : tileEnd;
+
+				for (uint64_t x = tileBegin; x < interiorBegin; ++x)
+				{
+					computeBorderElement(rowStart + x);
+				}
+
+				if (interiorBegin < interiorEnd)
+				{
+					TValue* output = _values + rowStart + interiorBegin;
+					const TValue* input = tensor._values + rowStart + interiorBegin;
+					const uint64_t count = interiorEnd - interiorBegin;
+
+					std::fill_n(output, count, TValue(0));
+
+					for (uint64_t k = 0; k < kernel._length; ++k)
+					{
+						_scp::multiplyAdd(output, input + kernelOffsets[k], kernel._values[k], count);
+					}
+				}
+
+				for (uint64_t x = interiorEnd; x < tileEnd; ++x)
+				{
+					computeBorderElement(rowStart + x);
 				}
 			}
+		});
+	}
 
-			_ndCooleyTukey(_values, _shape.order, bases);
+	template<typename TValue>
+	template<BorderBehaviour BBehaviour>
+	constexpr void Tensor<TValue>::separableConvolution(const Vector<TValue>* kernels)
+	{
+		_scp::ScratchBuffer<const TValue*> kernelValues(_shape.order);
+		_scp::ScratchBuffer<uint64_t> kernelSizes(_shape.order);
+		for (uint64_t i = 0; i < _shape.order; ++i)
+		{
+			kernelValues[i] = kernels[i].getData();
+			kernelSizes[i] = kernels[i].getElementCount();
+		}
+
+		_separableConvolution<BBehaviour>(kernelValues.getData(), kernelSizes.getData());
+	}
+
+	template<typename TValue>
+	template<BorderBehaviour BBehaviour>
+	constexpr void Tensor<TValue>::separableConvolution(const std::initializer_list<Vector<TValue>>& kernels)
+	{
+		assert(kernels.size() == _shape.order);
+		separableConvolution<BBehaviour>(kernels.begin());
+	}
+
+	template<typename TValue>
+	template<BorderBehaviour BBehaviour>
+	constexpr void Tensor<TValue>::_separableConvolution(const TValue* const* kernels, const uint64_t* kernelSizes)
+	{
+		_detachValues();
+
+		// One pass per axis. Lines are processed by blocks of consecutive lines, copied with their borders in a buffer
+		// so that strided axes are read and written contiguously.
+
+		constexpr uint64_t blockSize = 16;
+
+		uint64_t outerCount = 1;
+		uint64_t innerCount = _length;
+
+		for (uint64_t axis = 0; axis < _shape.order; ++axis)
+		{
+			const uint64_t size = _shape.sizes[axis];
+			const uint64_t kernelSize = kernelSizes[axis];
+			const TValue* kernel = kernels[axis];
+			const uint64_t offset = kernelSize / 2;
+
+			assert(kernelSize & 1);
+			assert(kernelSize <= size);
+
+			innerCount /= size;
+
+			const uint64_t blockWidth = std::min(innerCount, blockSize);
+			const uint64_t blockCount = (innerCount + blockWidth - 1) / blockWidth;
+
+			_scp::parallelFor(outerCount * blockCount, blockWidth * size * kernelSize, [&](uint64_t begin, uint64_t end)
+			{
+				_scp::ScratchBuffer<TValue> buffer((size + 2 * offset) * blockWidth);
 
+				for (uint64_t i = begin; i < end; ++i)
+				{
+					const uint64_t firstLine = (i % blockCount) * blockWidth;
+					TValue* lines = _values + (i / blockCount) * size * innerCount + firstLine;
+					const uint64_t width = std::min(blockWidth, innerCount - firstLine);
+
+					// When the block spans whole rows, the lines and the buffer rows are both contiguous
+
+					const bool contiguous = (width == innerCount);
+
+					if (contiguous)
+					{
+						std::copy_n(lines, size * width, buffer.getData() + offset * width);
+					}
+
+					for (uint64_t y = 0; y < size + 2 * offset; ++y)
+					{
+						const int64_t x = static_cast<int64_t>(y) - static_cast<int64_t>(offset);
+						TValue* row = buffer.getData() + y * width;
+
+						if (x >= 0 && x < static_cast<int64_t>(size))
+						{
+							if (!contiguous)
+							{
+								std::copy_n(lines + x * innerCount, width, row);
+							}
+						}
+						else if constexpr (BBehaviour == BorderBehaviour::Zero)
+						{
+							std::fill_n(row, width, TValue(0));
+						}
+						else if constexpr (BBehaviour == BorderBehaviour::Continuous)
+						{
+							std::copy_n(lines + (x < 0 ? 0 : size - 1) * innerCount, width, row);
+						}
+						else if constexpr (BBehaviour == BorderBehaviour::Periodic)
+						{
+							std::copy_n(lines + ((x + size) % size) * innerCount, width, row);
+						}
+					}
+
+					if (contiguous)
+					{
+						std::fill_n(lines, size * width, TValue(0));
+
+						for (uint64_t q = 0; q < kernelSize; ++q)
+						{
+							_scp::multiplyAdd(lines, buffer.getData() + (2 * offset - q) * width, kernel[q], size * width);
+						}
+					}
+					else
+					{
+						for (uint64_t x = 0; x < size; ++x)
+						{
+							TValue* output = lines + x * innerCount;
+							std::fill_n(output, width, TValue(0));
+
+							for (uint64_t q = 0; q < kernelSize; ++q)
+							{
+								_scp::multiplyAdd(output, buffer.getData() + (x + 2 * offset - q) * width, kernel[q], width);
+							}
+						}
+					}
+				}
+			});
+
+			outerCount *= size;
+		}
+	}
+
+	template<typename TValue>
+	template<BorderBehaviour BBehaviour>
+	constexpr void Tensor<TValue>::_fftConvolution(const Tensor<TValue>& kernel)
+	{
+		// Periodic borders are a circular convolution on the tensor itself. Zero borders need the tensor to be padded
+		// by at least half the kernel so that the wrapped around kernel only reads zeros.
+
+		uint64_t* sizes = reinterpret_cast<uint64_t*>(alloca(_shape.order * sizeof(uint64_t)));
+		uint64_t* origin = reinterpret_cast<uint64_t*>(alloca(_shape.order * sizeof(uint64_t)));
+		uint64_t* indices = reinterpret_cast<uint64_t*>(alloca(_shape.order * sizeof(uint64_t)));
+		for (uint64_t i = 0; i < _shape.order; ++i)
+		{
+			sizes[i] = (BBehaviour == BorderBehaviour::Periodic) ? _shape.sizes[i] : _scp::fftFastSize(_shape.sizes[i] + kernel._shape.sizes[i] / 2);
+			origin[i] = 0;
+		}
+
+		Tensor<TValue> padded(_shape.order, sizes, TValue(0));
+		TensorView<TValue>(padded).block(origin, _shape.sizes) = *this;
+
+		// The kernel is centered on the origin, its negative offsets wrapping around
+
+		Tensor<TValue> paddedKernel(_shape.order, sizes, TValue(0));
+		kernel._shape.forEach([&](const uint64_t* kernelIndices, uint64_t kernelIndex)
+		{
 			for (uint64_t i = 0; i < _shape.order; ++i)
 			{
-				delete[] bases[i];
+				indices[i] = (kernelIndices[i] + sizes[i] - kernel._shape.sizes[i] / 2) % sizes[i];
 			}
-			delete[] bases;
 
-			*this /= TValue(_length);
+			paddedKernel.get(indices) = kernel._values[kernelIndex];
+		});
+
+		if constexpr (CComplex<TValue>)
+		{
+			padded.fft();
+			paddedKernel.fft();
+			padded.hadamardProduct(paddedKernel);
+			padded.ifft();
 		}
 		else
 		{
-			assert(false);
+			std::copy_n(sizes, _shape.order, indices);
+			indices[_shape.order - 1] = sizes[_shape.order - 1] / 2 + 1;
+
+			Tensor<std::complex<TValue>> spectrum(_shape.order, indices);
+			Tensor<std::complex<TValue>> kernelSpectrum(_shape.order, indices);
+
+			padded.rfft(spectrum);
+			paddedKernel.rfft(kernelSpectrum);
+			spectrum.hadamardProduct(kernelSpectrum);
+			spectrum.irfft(padded);
 		}
+
+		*this = TensorView<const TValue>(padded).block(origin, _shape.sizes);
 	}
 
 	template<typename TValue>
-	template<BorderBehaviour BBehaviour>
-	constexpr void Tensor<TValue>::convolution(const Tensor<TValue>& kernel)
+	constexpr bool Tensor<TValue>::_separateKernel(TValue* const* factors) const
 	{
-		assert(_shape.order == kernel._shape.order);
-		
-		// Do a copy of *this
-		Tensor<TValue> tensor(*this);
-		
-		// Check that the kernel's sizes are odd
-		for (uint64_t i = 0; i < _shape.order; i++)
+		// A rank-1 kernel is the outer product of its lines passing through its largest element, up to a power of it
+
+		using TReal = decltype(std::abs(std::declval<TValue>()));
+
+		const TValue* pivot = std::max_element(_values, _values + _length, [](const TValue& x, const TValue& y) { return std::abs(x) < std::abs(y); });
+		const TReal pivotNorm = std::abs(*pivot);
+		if (pivotNorm == 0)
 		{
-			assert(kernel._shape.sizes[i] & 1);
-			assert(kernel._shape.sizes[i] <= _shape.sizes[i]);
+			return false;
 		}
-		
-		// Compute offset (to center the kernel)
-		int64_t* offset = reinterpret_cast<int64_t*>(alloca(_shape.order * sizeof(int64_t)));
-		for (uint64_t i = 0; i < _shape.order; i++)
+
+		uint64_t* indices = reinterpret_cast<uint64_t*>(alloca(_shape.order * sizeof(uint64_t)));
+		_shape.getIndices(pivot - _values, indices);
+
+		for (uint64_t axis = 0; axis < _shape.order; ++axis)
 		{
-			offset[i] = static_cast<int64_t>(kernel._shape.sizes[i] / 2);
+			const uint64_t pivotIndex = indices[axis];
+
+			for (uint64_t i = 0; i < _shape.sizes[axis]; ++i)
+			{
+				indices[axis] = i;
+				factors[axis][i] = get(indices);
+			}
+
+			indices[axis] = pivotIndex;
 		}
-		
-		// For each element of the original tensor
-		int64_t* offsetedIndices = reinterpret_cast<int64_t*>(alloca(_shape.order * sizeof(int64_t)));
+
+		for (uint64_t axis = 1; axis < _shape.order; ++axis)
+		{
+			for (uint64_t i = 0; i < _shape.sizes[0]; ++i)
+			{
+				factors[0][i] /= *pivot;
+			}
+		}
+
+		const TReal tolerance = 64 * std::numeric_limits<TReal>::epsilon() * pivotNorm;
 		for (const TensorPosition& pos : _shape)
 		{
-			TValue value = 0;
-		
-			// For each element of the kernel
-			for (const TensorPosition& kernelPos : kernel._shape)
+			TValue product = factors[0][pos.indices[0]];
+			for (uint64_t axis = 1; axis < _shape.order; ++axis)
 			{
-				bool setToZero = false;
-		
-				int64_t* itOffsetedIndices = offsetedIndices;
-				const uint64_t* itSizes = _shape.sizes;
-				const int64_t* itOffset = offset;
-				const uint64_t* itIndices = pos.indices;
-				const uint64_t* itKernelIndices = kernelPos.indices;
-		
-				// Compute the corresponding indices to poll
-				for (uint64_t k = 0; k < _shape.order; ++k, ++itKernelIndices, ++itOffsetedIndices, ++itSizes, ++itOffset, ++itIndices)
-				{
-					*itOffsetedIndices = static_cast<int64_t>(*itIndices) + *itOffset - static_cast<int64_t>(*itKernelIndices);
-		
-					if constexpr (BBehaviour == BorderBehaviour::Zero)
-					{
-						if (*itOffsetedIndices < 0 || *itOffsetedIndices >= *itSizes)
-						{
-							setToZero = true;
-							break;
-						}
-					}
-					else if constexpr (BBehaviour == BorderBehaviour::Continuous)
-					{
-						*itOffsetedIndices = std::clamp<int64_t>(*itOffsetedIndices, 0, *itSizes - 1);
-					}
-					else if constexpr (BBehaviour == BorderBehaviour::Periodic)
-					{
-						*itOffsetedIndices = (*itOffsetedIndices + *itSizes) % *itSizes;
-					}
-				}
-		
-				// Add the product to the result
-				if (!setToZero)
-				{
-					value += tensor.get(reinterpret_cast<uint64_t*>(offsetedIndices)) * kernel.get(kernelPos.index);
-				}
+				product *= factors[axis][pos.indices[axis]];
+			}
+
+			if (std::abs(product - _values[pos.index]) > tolerance)
+			{
+				return false;
 			}
-		
-			_values[pos.index] = value;
 		}
+
+		return true;
 	}
 
 	template<typename TValue>
@@ -538,37 +1263,42 @@ namespace scp
 	{
 		assert(_shape.order == tensor._shape.order);
 		
-		uint64_t* indices = reinterpret_cast<uint64_t*>(alloca(_shape.order * sizeof(uint64_t)));
-		TScalar* coeffs = reinterpret_cast<TScalar*>(alloca(_shape.order * sizeof(TScalar)));
-	
+		_detachValues();
+
 		TScalar* sizesRatio = reinterpret_cast<TScalar*>(alloca(_shape.order * sizeof(TScalar)));
 		for (uint64_t i = 0; i < _shape.order; ++i)
 		{
 			sizesRatio[i] = static_cast<TScalar>(tensor._shape.sizes[i] - 1) / (_shape.sizes[i] - 1);
 		}
-		
-		for (const TensorPosition& pos : _shape)
+
+		_scp::parallelFor(_length, uint64_t(1) << (2 * _shape.order), [&](uint64_t begin, uint64_t end)
 		{
-			for (uint64_t i = 0; i < _shape.order; ++i)
-			{
-				coeffs[i] = pos.indices[i] * sizesRatio[i];
-				indices[i] = static_cast<uint64_t>(coeffs[i]);
-				coeffs[i] -= indices[i];
-			}
-		
-			if constexpr (IMethod == InterpolationMethod::Nearest)
-			{
-				_values[pos.index] = tensor.get(indices);
-			}
-			else if constexpr (IMethod == InterpolationMethod::Linear)
-			{
-				_values[pos.index] = _scp::lerp<TValue>(tensor, tensor._shape.order, tensor._shape.sizes, indices, coeffs, 0);
-			}
-			else if constexpr (IMethod == InterpolationMethod::Cubic)
+			uint64_t* indices = reinterpret_cast<uint64_t*>(alloca(_shape.order * sizeof(uint64_t)));
+			TScalar* coeffs = reinterpret_cast<TScalar*>(alloca(_shape.order * sizeof(TScalar)));
+
+			_shape.forEach(begin, end, [&](const uint64_t* positionIndices, uint64_t index)
 			{
-				_values[pos.index] = _scp::cerp<TValue>(tensor, tensor._shape.order, tensor._shape.sizes, indices, coeffs, 0);
-			}
-		}
+				for (uint64_t i = 0; i < _shape.order; ++i)
+				{
+					coeffs[i] = positionIndices[i] * sizesRatio[i];
+					indices[i] = static_cast<uint64_t>(coeffs[i]);
+					coeffs[i] -= indices[i];
+				}
+
+				if constexpr (IMethod == InterpolationMethod::Nearest)
+				{
+					_values[index] = tensor.get(indices);
+				}
+				else if constexpr (IMethod == InterpolationMethod::Linear)
+				{
+					_values[index] = _scp::lerp<TValue>(tensor, tensor._shape.order, tensor._shape.sizes, indices, coeffs, 0);
+				}
+				else if constexpr (IMethod == InterpolationMethod::Cubic)
+				{
+					_values[index] = _scp::cerp<TValue>(tensor, tensor._shape.order, tensor._shape.sizes, indices, coeffs, 0);
+				}
+			});
+		});
 	}
 
 	template<typename TValue>
@@ -581,6 +1311,8 @@ namespace scp
 		assert(j < tensor._shape.order);
 		assert(tensor._shape.sizes[i] == tensor._shape.sizes[j]);
 
+		_detachValues();
+
 		if (i > j)
 		{
 			std::swap(i, j);
@@ -590,30 +1322,37 @@ namespace scp
 		assert(j == i + 1 || std::equal(_shape.sizes + i, _shape.sizes + j - 1, tensor._shape.sizes + i + 1));
 		assert(j == tensor._shape.order - 1 || std::equal(_shape.sizes + j - 1, _shape.sizes + _shape.order, tensor._shape.sizes + j + 1));
 		
-		uint64_t* indices = reinterpret_cast<uint64_t*>(alloca(_shape.order * sizeof(uint64_t)));
-		for (const TensorPosition& pos : _shape)
+		// Each axis of the result maps to an axis of tensor, and the contracted pair of axes is walked along its
+		// diagonal, whose stride is the sum of both strides
+
+		int64_t* tensorStrides = reinterpret_cast<int64_t*>(alloca(tensor._shape.order * sizeof(int64_t)));
+		int64_t* strides = reinterpret_cast<int64_t*>(alloca(_shape.order * sizeof(int64_t)));
+
+		int64_t stride = 1;
+		for (uint64_t k = tensor._shape.order; k-- > 0;)
 		{
-			if (i != 0)
-			{
-				std::copy(pos.indices, pos.indices + i, indices);
-			}
-			if (i != j - 1)
-			{
-				std::copy(pos.indices + i, pos.indices + j - 1, indices + i + 1);
-			}
-			if (j != _shape.order - 1)
-			{
-				std::copy(pos.indices + j - 1, pos.indices + _shape.order, indices + j + 1);
-			}
-		
-			_values[pos.index] = 0;
-			for (uint64_t k = 0; k < tensor._shape.sizes[i]; ++k)
-			{
-				indices[i] = k;
-				indices[j] = k;
-				_values[pos.index] += tensor.get(indices);
-			}
+			tensorStrides[k] = stride;
+			stride *= static_cast<int64_t>(tensor._shape.sizes[k]);
 		}
+
+		std::copy(tensorStrides, tensorStrides + i, strides);
+		std::copy(tensorStrides + i + 1, tensorStrides + j, strides + i);
+		std::copy(tensorStrides + j + 1, tensorStrides + tensor._shape.order, strides + j - 1);
+
+		const int64_t diagonalStride = tensorStrides[i] + tensorStrides[j];
+		const uint64_t diagonalSize = tensor._shape.sizes[i];
+
+		_scp::parallelFor(_length, diagonalSize, [&](uint64_t begin, uint64_t end)
+		{
+			_shape.forEach(begin, end, strides, [&](const uint64_t*, uint64_t index, int64_t offset)
+			{
+				_values[index] = 0;
+				for (uint64_t k = 0; k < diagonalSize; ++k)
+				{
+					_values[index] += tensor._values[offset + static_cast<int64_t>(k) * diagonalStride];
+				}
+			});
+		});
 	}
 
 	template<typename TValue>
@@ -635,12 +1374,14 @@ namespace scp
 	template<typename TValue>
 	constexpr TValue* Tensor<TValue>::begin()
 	{
+		_leakValues();
 		return _values;
 	}
 
 	template<typename TValue>
 	constexpr TValue* Tensor<TValue>::end()
 	{
+		_leakValues();
 		return _values + _length;
 	}
 
@@ -781,6 +1522,7 @@ namespace scp
 	template<typename TValue>
 	constexpr TValue& Tensor<TValue>::operator[](uint64_t index)
 	{
+		_detachValues();
 		assert(index < _length);
 		return _values[index];
 	}
@@ -795,6 +1537,7 @@ namespace scp
 	template<typename TValue>
 	constexpr TValue& Tensor<TValue>::operator[](const std::initializer_list<uint64_t>& indices)
 	{
+		_detachValues();
 		assert(_shape.getIndex(indices.begin()) < _length);
 		return _values[_shape.getIndex(indices.begin())];
 	}
@@ -830,6 +1573,7 @@ namespace scp
 	template<typename TValue>
 	constexpr TValue& Tensor<TValue>::get(uint64_t index)
 	{
+		_detachValues();
 		assert(index < _length);
 		return _values[index];
 	}
@@ -837,6 +1581,7 @@ namespace scp
 	template<typename TValue>
 	constexpr TValue& Tensor<TValue>::get(const uint64_t* indices)
 	{
+		_detachValues();
 		assert(_shape.getIndex(indices) < _length);
 		return _values[_shape.getIndex(indices)];
 	}
@@ -844,6 +1589,7 @@ namespace scp
 	template<typename TValue>
 	constexpr TValue& Tensor<TValue>::get(const std::initializer_list<uint64_t>& indices)
 	{
+		_detachValues();
 		assert(_shape.getIndex(indices.begin()) < _length);
 		return _values[_shape.getIndex(indices.begin())];
 	}
@@ -851,6 +1597,7 @@ namespace scp
 	template<typename TValue>
 	constexpr void Tensor<TValue>::set(uint64_t index, const TValue& value)
 	{
+		_detachValues();
 		assert(index < _length);
 		_values[index] = value;
 	}
@@ -858,6 +1605,7 @@ namespace scp
 	template<typename TValue>
 	constexpr void Tensor<TValue>::set(const uint64_t* indices, const TValue& value)
 	{
+		_detachValues();
 		assert(_shape.getIndex(indices) < _length);
 		_values[_shape.getIndex(indices)] = value;
 	}
@@ -865,6 +1613,7 @@ namespace scp
 	template<typename TValue>
 	constexpr void Tensor<TValue>::set(const std::initializer_list<uint64_t>& indices, const TValue& value)
 	{
+		_detachValues();
 		assert(_shape.getIndex(indices.begin()) < _length);
 		_values[_shape.getIndex(indices.begin())] = value;
 	}
@@ -903,6 +1652,7 @@ namespace scp
 	template<typename TValue>
 	constexpr TValue* Tensor<TValue>::getData()
 	{
+		_leakValues();
 		return _values;
 	}
 
@@ -919,411 +1669,113 @@ namespace scp
 		{
 			if (_owner)
 			{
-				delete[] _values;
+				_deallocateValues();
 			}
 
 			delete[] _shape.sizes;
 		}
 	}
 
-	namespace _scp
+	template<typename TValue>
+	constexpr void Tensor<TValue>::_allocateValues()
 	{
-		constexpr uint64_t reverse(uint64_t n, uint8_t bitCount)
-		{
-			constexpr uint8_t lookup[256] = {
-				0b00000000, 0b10000000, 0b01000000, 0b11000000, 0b00100000, 0b10100000, 0b01100000, 0b11100000,
-				0b00010000, 0b10010000, 0b01010000, 0b11010000, 0b00110000, 0b10110000, 0b01110000, 0b11110000,
-				0b00001000, 0b10001000, 0b01001000, 0b11001000, 0b00101000, 0b10101000, 0b01101000, 0b11101000,
-				0b00011000, 0b10011000, 0b01011000, 0b11011000, 0b00111000, 0b10111000, 0b01111000, 0b11111000,
-				0b00000100, 0b10000100, 0b01000100, 0b11000100, 0b00100100, 0b10100100, 0b01100100, 0b11100100,
-				0b00010100, 0b10010100, 0b01010100, 0b11010100, 0b00110100, 0b10110100, 0b01110100, 0b11110100,
-				0b00001100, 0b10001100, 0b01001100, 0b11001100, 0b00101100, 0b10101100, 0b01101100, 0b11101100,
-				0b00011100, 0b10011100, 0b01011100, 0b11011100, 0b00111100, 0b10111100, 0b01111100, 0b11111100,
-				0b00000010, 0b10000010, 0b01000010, 0b11000010, 0b00100010, 0b10100010, 0b01100010, 0b11100010,
-				0b00010010, 0b10010010, 0b01010010, 0b11010010, 0b00110010, 0b10110010, 0b01110010, 0b11110010,
-				0b00001010, 0b10001010, 0b01001010, 0b11001010, 0b00101010, 0b10101010, 0b01101010, 0b11101010,
-				0b00011010, 0b10011010, 0b01011010, 0b11011010, 0b00111010, 0b10111010, 0b01111010, 0b11111010,
-				0b00000110, 0b10000110, 0b01000110, 0b11000110, 0b00100110, 0b10100110, 0b01100110, 0b11100110,
-				0b00010110, 0b10010110, 0b01010110, 0b11010110, 0b00110110, 0b10110110, 0b01110110, 0b11110110,
-				0b00001110, 0b10001110, 0b01001110, 0b11001110, 0b00101110, 0b10101110, 0b01101110, 0b11101110,
-				0b00011110, 0b10011110, 0b01011110, 0b11011110, 0b00111110, 0b10111110, 0b01111110, 0b11111110,
-				0b00000001, 0b10000001, 0b01000001, 0b11000001, 0b00100001, 0b10100001, 0b01100001, 0b11100001,
-				0b00010001, 0b10010001, 0b01010001, 0b11010001, 0b00110001, 0b10110001, 0b01110001, 0b11110001,
-				0b00001001, 0b10001001, 0b01001001, 0b11001001, 0b00101001, 0b10101001, 0b01101001, 0b11101001,
-				0b00011001, 0b10011001, 0b01011001, 0b11011001, 0b00111001, 0b10111001, 0b01111001, 0b11111001,
-				0b00000101, 0b10000101, 0b01000101, 0b11000101, 0b00100101, 0b10100101, 0b01100101, 0b11100101,
-				0b00010101, 0b10010101, 0b01010101, 0b11010101, 0b00110101, 0b10110101, 0b01110101, 0b11110101,
-				0b00001101, 0b10001101, 0b01001101, 0b11001101, 0b00101101, 0b10101101, 0b01101101, 0b11101101,
-				0b00011101, 0b10011101, 0b01011101, 0b11011101, 0b00111101, 0b10111101, 0b01111101, 0b11111101,
-				0b00000011, 0b10000011, 0b01000011, 0b11000011, 0b00100011, 0b10100011, 0b01100011, 0b11100011,
-				0b00010011, 0b10010011, 0b01010011, 0b11010011, 0b00110011, 0b10110011, 0b01110011, 0b11110011,
-				0b00001011, 0b10001011, 0b01001011, 0b11001011, 0b00101011, 0b10101011, 0b01101011, 0b11101011,
-				0b00011011, 0b10011011, 0b01011011, 0b11011011, 0b00111011, 0b10111011, 0b01111011, 0b11111011,
-				0b00000111, 0b10000111, 0b01000111, 0b11000111, 0b00100111, 0b10100111, 0b01100111, 0b11100111,
-				0b00010111, 0b10010111, 0b01010111, 0b11010111, 0b00110111, 0b10110111, 0b01110111, 0b11110111,
-				0b00001111, 0b10001111, 0b01001111, 0b11001111, 0b00101111, 0b10101111, 0b01101111, 0b11101111,
-				0b00011111, 0b10011111, 0b01011111, 0b11011111, 0b00111111, 0b10111111, 0b01111111, 0b11111111,
-			};
-
-			uint64_t result = lookup[n & 0xFF];
-			if (bitCount > 8)
-			{
-				result = (result << 8) | lookup[(n >>= 8) & 0xFF];
-				if (bitCount > 16)
-				{
-					result = (result << 8) | lookup[(n >>= 8) & 0xFF];
-					if (bitCount > 24)
-					{
-						result = (result << 8) | lookup[(n >>= 8) & 0xFF];
-						if (bitCount > 32)
-						{
-							result = (result << 8) | lookup[(n >>= 8) & 0xFF];
-							if (bitCount > 40)
-							{
-								result = (result << 8) | lookup[(n >>= 8) & 0xFF];
-								if (bitCount > 48)
-								{
-									result = (result << 8) | lookup[(n >>= 8) & 0xFF];
-									if (bitCount > 56)
-									{
-										result = (result << 8) | lookup[(n >>= 8) & 0xFF];
-									}
-								}
-							}
-						}
-					}
-				}
-			}
-			return result >> ((64 - bitCount) % 8);
-		}
-	
-		template<typename TValue>
-		constexpr void bitReversal(TValue* beg, uint64_t stride, uint64_t size, uint8_t bitCount)
+		if consteval
 		{
-			TValue* it = beg + stride;
-			for (uint64_t i = 1; i < size; ++i, it += stride)
-			{
-				uint64_t r = reverse(i, bitCount);
-				if (r > i)
-				{
-					std::swap(*it, *(beg + r * stride));
-				}
-			}
+			_values = new TValue[_length];
+			_allocator = nullptr;
+			_references = nullptr;
 		}
-
-		template<typename TValue>
-		constexpr void cooleyTukeyRadix2(TValue* beg, uint64_t stride, const TValue* base, uint64_t baseStride, uint64_t size)
+		else
 		{
-			if (size == 2)
-			{
-				TValue& x0 = *beg;
-				TValue& x1 = *(beg + stride);
-				const TValue tmp = x0;
-				x0 += *base * x1;
-				x1 = tmp + *(base + baseStride) * x1;
-			}
-			else
-			{
-				size >>= 1;
-				baseStride <<= 1;
-
-				cooleyTukeyRadix2(beg, stride, base, baseStride, size);
-				cooleyTukeyRadix2(beg + size * stride, stride, base, baseStride, size);
-
-				baseStride >>= 1;
-
-				TValue* it = beg;
-				TValue* it2 = it + size * stride;
-				const TValue* const itEnd = it2;
-				for (; it != itEnd; it += stride, it2 += stride, base += baseStride)
-				{
-					TValue tmp = *base * *it2;
-					*it2 = *it - tmp;
-					*it += tmp;
-				}
-			}
+			_allocator = tensorAllocator;
+			_values = static_cast<TValue*>(_allocator->allocate(_length * sizeof(TValue), std::max<uint64_t>(_scp::tensorAlignment, alignof(TValue))));
+			std::uninitialized_default_construct_n(_values, _length);
+			_references = tensorCopyOnWrite ? new std::atomic<uint64_t>(1) : nullptr;
 		}
+	}
 
-		template<typename TValue>
-		constexpr void cooleyTukey(TValue* beg, uint64_t stride, const TValue* base, uint64_t baseStride, uint64_t size, std::pair<uint64_t, uint64_t>* factors, uint64_t factorCount)
+	template<typename TValue>
+	constexpr void Tensor<TValue>::_deallocateValues()
+	{
+		// Shared values are destroyed with their last reference
+
+		if (_references)
 		{
-			if (size == 1)
+			if (_references->fetch_sub(1, std::memory_order_acq_rel) != 1)
 			{
+				_values = nullptr;
+				_allocator = nullptr;
+				_references = nullptr;
 				return;
 			}
 
-			// TODO: https://en.wikipedia.org/wiki/Rader%27s_FFT_algorithm
-			// if (factorCount == 1 && factors->second == 1)
-			// {
-			// }
-
-			// Compute best radix and remove it from factors
-
-			const uint64_t radix = factors->first;
-
-			--factors->second;
-			if (factors->second == 0)
-			{
-				++factors;
-				--factorCount;
-			}
-
-			// Re-order elements according to radix
-
-			const uint64_t subSize = size / radix;
-
-			std::vector<bool> visited(size, false);
-			visited[0] = true;
-			visited[size - 1] = true;
-
-			uint64_t n = 0;
-			uint64_t preced, next;
-			while (n != size)
-			{
-				if (visited[n])
-				{
-					++n;
-					continue;
-				}
-
-				TValue tmp = *(beg + n * stride);
-				visited[n] = true;
-
-				preced = n;
-				next = preced / subSize + (preced % subSize) * radix;
-
-				while (next != n)
-				{
-					*(beg + preced * stride) = *(beg + next * stride);
-					visited[next] = true;
-
-					preced = next;
-					next = preced / subSize + (preced % subSize) * radix;
-				}
-
-				*(beg + preced * stride) = tmp;
-			}
-
-			// Run algorithm on sub-ranges
-
-			size = subSize;
-			baseStride *= radix;
-
-			for (uint64_t i = 0; i < radix; ++i)
-			{
-				cooleyTukey(beg + i * size * stride, stride, base, baseStride, size, factors, factorCount);
-			}
-
-			baseStride /= radix;
-			const uint64_t realSize = size * radix;
-
-			// Put back the factor
-
-			if (factors->first != radix)
-			{
-				--factors;
-				++factorCount;
-			}
-			++factors->second;
-
-			// Merge sub-ranges
-
-			const uint64_t rangeOffset = size * stride;
-				
-			std::vector<TValue> tmp(radix);
-			TValue* it = beg;
-			for (uint64_t i = 0; i < size; ++i, it += stride)
-			{
-				for (uint64_t j = 0; j < radix; ++j, it += rangeOffset)
-				{
-					tmp[j] = *it;
-				}
-				it -= radix * rangeOffset;
-
-				uint64_t coeff = i;
-				for (uint64_t j = 0; j < radix; ++j, it += rangeOffset, coeff += size)
-				{
-					*it = 0;
-					for (uint64_t k = 0; k < radix; ++k)
-					{
-						*it += tmp[k] * *(base + ((k * coeff) % realSize) * baseStride);
-					}
-				}
-				it -= radix * rangeOffset;
-			}
+			delete _references;
+			_references = nullptr;
 		}
-	}
 
-	template<typename TValue>
-	constexpr void Tensor<TValue>::_ndCooleyTukey(TValue* beg, uint64_t order, const TValue* const* bases)
-	{
-		const uint64_t& size = *(_shape.sizes + _shape.order - order);
-		
-		const uint64_t subLength = std::accumulate(_shape.sizes + _shape.order - order + 1, _shape.sizes + _shape.order, 1, std::multiplies<uint64_t>());
-		
-		if (order > 1)
+		if (_allocator)
 		{
-			for (uint64_t i = 0; i < size; ++i)
-			{
-				_ndCooleyTukey(beg + i * subLength, order - 1, bases);
-			}
+			std::destroy_n(_values, _length);
+			_allocator->deallocate(_values, _length * sizeof(TValue), std::max<uint64_t>(_scp::tensorAlignment, alignof(TValue)));
 		}
-
-		if (size > 1)
+		else
 		{
-			const TValue* base = bases[_shape.order - order];
-
-			if ((size & (size - 1)) == 0)
-			{
-				for (uint64_t i = 0; i < subLength; ++i)
-				{
-					_scp::bitReversal(beg + i, subLength, size, std::log2(size));
-					_scp::cooleyTukeyRadix2(beg + i, subLength, base, 1, size);
-				}
-			}
-			else
-			{
-				std::vector<std::pair<uint64_t, uint64_t>> factors, factorsCopy;
-				primeFactors(size, factors);
-
-				for (uint64_t i = 0; i < subLength; ++i)
-				{
-					factorsCopy = factors;
-					_scp::cooleyTukey(beg + i, subLength, base, 1, size, factorsCopy.data(), factorsCopy.size());
-				}
-			}
+			delete[] _values;
 		}
-	}
-
-
-	template<typename TValue>
-	constexpr Tensor<TValue> operator+(const Tensor<TValue>& tensorA, const Tensor<TValue>& tensorB)
-	{
-		Tensor<TValue> tensorC(tensorA);
-		tensorC += tensorB;
-		return tensorC;
-	}
-
-	template<typename TValue>
-	constexpr Tensor<TValue>&& operator+(Tensor<TValue>&& tensorA, const Tensor<TValue>& tensorB)
-	{
-		tensorA += tensorB;
-		return std::forward(tensorA);
-	}
-
-	template<typename TValue>
-	constexpr Tensor<TValue>&& operator+(const Tensor<TValue>& tensorA, Tensor<TValue>&& tensorB)
-	{
-		tensorB += tensorA;
-		return std::forward(tensorB);
-	}
-
-	template<typename TValue>
-	constexpr Tensor<TValue>&& operator+(Tensor<TValue>&& tensorA, Tensor<TValue>&& tensorB)
-	{
-		tensorA += tensorB;
-		return std::forward(tensorA);
-	}
 
-	template<typename TValue>
-	constexpr Tensor<TValue> operator-(const Tensor<TValue>& tensorA, const Tensor<TValue>& tensorB)
-	{
-		Tensor<TValue> tensorC(tensorA);
-		tensorC -= tensorB;
-		return tensorC;
+		_values = nullptr;
+		_allocator = nullptr;
 	}
 
 	template<typename TValue>
-	constexpr Tensor<TValue>&& operator-(Tensor<TValue>&& tensorA, const Tensor<TValue>& tensorB)
+	constexpr bool Tensor<TValue>::_isShared() const
 	{
-		tensorA -= tensorB;
-		return std::forward(tensorA);
+		return _references && _references->load(std::memory_order_acquire) != 1;
 	}
 
 	template<typename TValue>
-	constexpr Tensor<TValue>&& operator-(const Tensor<TValue>& tensorA, Tensor<TValue>&& tensorB)
+	constexpr void Tensor<TValue>::_detachValues()
 	{
-		tensorB -= tensorA;
-		tensorB.negate();
-		return std::forward(tensorB);
+		if (_isShared()) [[unlikely]]
+		{
+			_copySharedValues();
+		}
 	}
 
 	template<typename TValue>
-	constexpr Tensor<TValue>&& operator-(Tensor<TValue>&& tensorA, Tensor<TValue>&& tensorB)
-	{
-		tensorA -= tensorB;
-		return std::forward(tensorA);
-	}
-
-	template<typename TValue, typename TScalar>
-	constexpr Tensor<TValue> operator*(const Tensor<TValue>& tensor, const TScalar& scalar)
-	{
-		Tensor<TValue> copy(tensor);
-		copy *= scalar;
-		return copy;
-	}
-
-	template<typename TValue, typename TScalar>
-	constexpr Tensor<TValue>&& operator*(Tensor<TValue>&& tensor, const TScalar& scalar)
-	{
-		tensor *= scalar;
-		return std::forward(tensor);
-	}
-
-	template<typename TValue, typename TScalar>
-	constexpr Tensor<TValue> operator*(const TScalar& scalar, const Tensor<TValue>& tensor)
+	constexpr void Tensor<TValue>::_copySharedValues()
 	{
-		Tensor<TValue> copy(tensor);
-		copy *= scalar;
-		return copy;
-	}
+		TValue* values = _values;
+		TensorAllocator* allocator = _allocator;
+		std::atomic<uint64_t>* references = _references;
 
-	template<typename TValue, typename TScalar>
-	constexpr Tensor<TValue>&& operator*(const TScalar& scalar, Tensor<TValue>&& tensor)
-	{
-		tensor *= scalar;
-		return std::forward(tensor);
-	}
+		_allocateValues();
+		std::copy_n(values, _length, _values);
 
-	template<typename TValue, typename TScalar>
-	constexpr Tensor<TValue> operator/(const Tensor<TValue>& tensor, const TScalar& scalar)
-	{
-		Tensor<TValue> copy(tensor);
-		copy /= scalar;
-		return copy;
-	}
+		_scp::countTensorDeepCopy(_shape, _length * sizeof(TValue), true);
 
-	template<typename TValue, typename TScalar>
-	constexpr Tensor<TValue>&& operator/(Tensor<TValue>&& tensor, const TScalar& scalar)
-	{
-		tensor /= scalar;
-		return std::forward(tensor);
-	}
+		// The other references may have been released in the meantime
 
-	template<typename TValue>
-	constexpr Tensor<TValue> operator-(const Tensor<TValue>& tensor)
-	{
-		Tensor<TValue> copy(tensor);
-		copy.negate();
-		return copy;
+		if (references->fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			std::destroy_n(values, _length);
+			allocator->deallocate(values, _length * sizeof(TValue), std::max<uint64_t>(_scp::tensorAlignment, alignof(TValue)));
+			delete references;
+		}
 	}
 
 	template<typename TValue>
-	constexpr Tensor<TValue>&& operator-(Tensor<TValue>&& tensor)
+	constexpr void Tensor<TValue>::_leakValues()
 	{
-		tensor.negate();
-		return std::forward(tensor);
-	}
+		// A pointer that escapes can be used to write at any time, so the values stop being reference counted and
+		// later copies duplicate them. Allocating new values makes the tensor shareable again.
 
-	template<typename TValue>
-	constexpr Tensor<TValue> operator+(const Tensor<TValue>& tensor)
-	{
-		return tensor;
-	}
+		if (_references)
+		{
+			_detachValues();
 
-	template<typename TValue>
-	constexpr Tensor<TValue>&& operator+(Tensor<TValue>&& tensor)
-	{
-		return std::forward(tensor);
+			delete _references;
+			_references = nullptr;
+		}
 	}
 }
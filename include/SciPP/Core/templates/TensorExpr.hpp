@@ -0,0 +1,362 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//! \file
+//! \author Plgrin Marius
+//! \copyright The MIT License (MIT)
+//! \date 2019-2024
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <SciPP/Core/CoreDecl.hpp>
+
+namespace scp
+{
+	namespace _scp
+	{
+		struct TensorExprAdd
+		{
+			template<typename TValue, typename TOther>
+			static constexpr TValue apply(TValue x, const TOther& y)
+			{
+				x += y;
+				return x;
+			}
+		};
+
+		struct TensorExprSub
+		{
+			template<typename TValue, typename TOther>
+			static constexpr TValue apply(TValue x, const TOther& y)
+			{
+				x -= y;
+				return x;
+			}
+		};
+
+		struct TensorExprMul
+		{
+			template<typename TValue, typename TOther>
+			static constexpr TValue apply(TValue x, const TOther& y)
+			{
+				x *= y;
+				return x;
+			}
+		};
+
+		struct TensorExprDiv
+		{
+			template<typename TValue, typename TOther>
+			static constexpr TValue apply(TValue x, const TOther& y)
+			{
+				x /= y;
+				return x;
+			}
+		};
+
+		struct TensorExprNeg
+		{
+			template<typename TValue>
+			static constexpr TValue apply(const TValue& x)
+			{
+				return -x;
+			}
+		};
+
+		template<typename TValue, typename TDense>
+		constexpr TensorExprRef<TValue, TDense>::TensorExprRef(const Tensor<TValue>& tensor) :
+			_shape(&tensor.getShape()),
+			_length(tensor.getElementCount()),
+			_values(tensor.getData())
+		{
+		}
+
+		template<typename TValue, typename TDense>
+		constexpr TensorExprRef<TValue, TDense>::TensorExprRef(const TensorShape& shape, const TValue* values) :
+			_shape(&shape),
+			_length(shape.getElementCount()),
+			_values(values)
+		{
+		}
+
+		template<typename TValue, typename TDense>
+		constexpr const TValue& TensorExprRef<TValue, TDense>::operator[](uint64_t index) const
+		{
+			assert(index < _length);
+			return _values[index];
+		}
+
+		template<typename TValue, typename TDense>
+		constexpr const TensorShape& TensorExprRef<TValue, TDense>::getShape() const
+		{
+			return *_shape;
+		}
+
+		template<typename TValue, typename TDense>
+		constexpr uint64_t TensorExprRef<TValue, TDense>::getElementCount() const
+		{
+			return _length;
+		}
+
+		template<typename TValue, typename TDense>
+		template<typename TOther>
+		constexpr bool TensorExprRef<TValue, TDense>::aliases(const TOther* values, const TensorShape& shape, const int64_t* strides) const
+		{
+			return elementsAlias(values, shape, strides, _values, *_shape, static_cast<const int64_t*>(nullptr));
+		}
+
+		template<typename TOp, typename TExprA, typename TExprB>
+		constexpr TensorExprBinary<TOp, TExprA, TExprB>::TensorExprBinary(const TExprA& exprA, const TExprB& exprB) :
+			_exprA(exprA),
+			_exprB(exprB)
+		{
+			assert(_exprA.getShape().order == _exprB.getShape().order);
+			assert(std::equal(_exprA.getShape().sizes, _exprA.getShape().sizes + _exprA.getShape().order, _exprB.getShape().sizes));
+		}
+
+		template<typename TOp, typename TExprA, typename TExprB>
+		constexpr typename TensorExprBinary<TOp, TExprA, TExprB>::ValueType TensorExprBinary<TOp, TExprA, TExprB>::operator[](uint64_t index) const
+		{
+			return TOp::template apply<ValueType>(_exprA[index], _exprB[index]);
+		}
+
+		template<typename TOp, typename TExprA, typename TExprB>
+		constexpr const TensorShape& TensorExprBinary<TOp, TExprA, TExprB>::getShape() const
+		{
+			return _exprA.getShape();
+		}
+
+		template<typename TOp, typename TExprA, typename TExprB>
+		constexpr uint64_t TensorExprBinary<TOp, TExprA, TExprB>::getElementCount() const
+		{
+			return _exprA.getElementCount();
+		}
+
+		template<typename TOp, typename TExprA, typename TExprB>
+		template<typename TOther>
+		constexpr bool TensorExprBinary<TOp, TExprA, TExprB>::aliases(const TOther* values, const TensorShape& shape, const int64_t* strides) const
+		{
+			return _exprA.aliases(values, shape, strides) || _exprB.aliases(values, shape, strides);
+		}
+
+		template<typename TOp, typename TExpr, typename TScalar>
+		constexpr TensorExprScalar<TOp, TExpr, TScalar>::TensorExprScalar(const TExpr& expr, const TScalar& scalar) :
+			_expr(expr),
+			_scalar(scalar)
+		{
+		}
+
+		template<typename TOp, typename TExpr, typename TScalar>
+		constexpr typename TensorExprScalar<TOp, TExpr, TScalar>::ValueType TensorExprScalar<TOp, TExpr, TScalar>::operator[](uint64_t index) const
+		{
+			return TOp::template apply<ValueType>(_expr[index], _scalar);
+		}
+
+		template<typename TOp, typename TExpr, typename TScalar>
+		constexpr const TensorShape& TensorExprScalar<TOp, TExpr, TScalar>::getShape() const
+		{
+			return _expr.getShape();
+		}
+
+		template<typename TOp, typename TExpr, typename TScalar>
+		constexpr uint64_t TensorExprScalar<TOp, TExpr, TScalar>::getElementCount() const
+		{
+			return _expr.getElementCount();
+		}
+
+		template<typename TOp, typename TExpr, typename TScalar>
+		template<typename TOther>
+		constexpr bool TensorExprScalar<TOp, TExpr, TScalar>::aliases(const TOther* values, const TensorShape& shape, const int64_t* strides) const
+		{
+			return _expr.aliases(values, shape, strides);
+		}
+
+		template<typename TOp, typename TExpr>
+		constexpr TensorExprUnary<TOp, TExpr>::TensorExprUnary(const TExpr& expr) :
+			_expr(expr)
+		{
+		}
+
+		template<typename TOp, typename TExpr>
+		constexpr typename TensorExprUnary<TOp, TExpr>::ValueType TensorExprUnary<TOp, TExpr>::operator[](uint64_t index) const
+		{
+			return TOp::template apply<ValueType>(_expr[index]);
+		}
+
+		template<typename TOp, typename TExpr>
+		constexpr const TensorShape& TensorExprUnary<TOp, TExpr>::getShape() const
+		{
+			return _expr.getShape();
+		}
+
+		template<typename TOp, typename TExpr>
+		constexpr uint64_t TensorExprUnary<TOp, TExpr>::getElementCount() const
+		{
+			return _expr.getElementCount();
+		}
+
+		template<typename TOp, typename TExpr>
+		template<typename TOther>
+		constexpr bool TensorExprUnary<TOp, TExpr>::aliases(const TOther* values, const TensorShape& shape, const int64_t* strides) const
+		{
+			return _expr.aliases(values, shape, strides);
+		}
+
+		template<CTensorOperand T>
+		constexpr auto toTensorExpr(const T& operand)
+		{
+			if constexpr (CTensorView<T>)
+			{
+				return TensorExprViewRef<std::remove_reference_t<decltype(*operand.getData())>>(operand);
+			}
+			else if constexpr (CTensorExpr<T>)
+			{
+				return operand;
+			}
+			else if constexpr (CStaticTensor<T>)
+			{
+				return TensorExprRef<typename T::ValueType, T>(operand.getShape(), operand.getData());
+			}
+			else
+			{
+				return TensorExprRef<typename T::ValueType, T>(operand);
+			}
+		}
+
+		template<typename TValueA, typename TValueB>
+		constexpr bool elementsAlias(const TValueA* valuesA, const TensorShape& shapeA, const int64_t* stridesA, const TValueB* valuesB, const TensorShape& shapeB, const int64_t* stridesB)
+		{
+			if consteval
+			{
+				// Unrelated pointers cannot be ordered in constant evaluation
+				return true;
+			}
+			else
+			{
+				// Byte range spanned by each set of elements
+
+				const auto getRange = [](const auto* values, const TensorShape& shape, const int64_t* strides)
+				{
+					int64_t low = 0;
+					int64_t high = 0;
+					int64_t stride = 1;
+					for (uint64_t i = shape.order; i-- > 0;)
+					{
+						const int64_t span = static_cast<int64_t>(shape.sizes[i] - 1) * (strides ? strides[i] : stride);
+						(span < 0 ? low : high) += span;
+						stride *= static_cast<int64_t>(shape.sizes[i]);
+					}
+
+					const uintptr_t begin = reinterpret_cast<uintptr_t>(values);
+					const int64_t size = sizeof(*values);
+					return std::make_pair(begin + low * size, begin + (high + 1) * size);
+				};
+
+				const auto [beginA, endA] = getRange(valuesA, shapeA, stridesA);
+				const auto [beginB, endB] = getRange(valuesB, shapeB, stridesB);
+
+				if (endA <= beginB || endB <= beginA)
+				{
+					return false;
+				}
+
+				if (static_cast<const void*>(valuesA) != static_cast<const void*>(valuesB) || sizeof(TValueA) != sizeof(TValueB) || shapeA.order != shapeB.order)
+				{
+					return true;
+				}
+
+				int64_t stride = 1;
+				for (uint64_t i = shapeA.order; i-- > 0;)
+				{
+					if (shapeA.sizes[i] != shapeB.sizes[i])
+					{
+						return true;
+					}
+
+					if (shapeA.sizes[i] != 1 && (stridesA ? stridesA[i] : stride) != (stridesB ? stridesB[i] : stride))
+					{
+						return true;
+					}
+
+					stride *= static_cast<int64_t>(shapeA.sizes[i]);
+				}
+
+				return false;
+			}
+		}
+	}
+
+	template<CTensorOperand TA, CTensorOperand TB> requires std::same_as<typename TA::ValueType, typename TB::ValueType>
+	constexpr auto operator+(const TA& a, const TB& b)
+	{
+		using TExprA = decltype(_scp::toTensorExpr(a));
+		using TExprB = decltype(_scp::toTensorExpr(b));
+		return _scp::TensorExprBinary<_scp::TensorExprAdd, TExprA, TExprB>(_scp::toTensorExpr(a), _scp::toTensorExpr(b));
+	}
+
+	template<CTensorOperand TA, CTensorOperand TB> requires std::same_as<typename TA::ValueType, typename TB::ValueType>
+	constexpr auto operator-(const TA& a, const TB& b)
+	{
+		using TExprA = decltype(_scp::toTensorExpr(a));
+		using TExprB = decltype(_scp::toTensorExpr(b));
+		return _scp::TensorExprBinary<_scp::TensorExprSub, TExprA, TExprB>(_scp::toTensorExpr(a), _scp::toTensorExpr(b));
+	}
+
+	template<CTensorOperand T, typename TScalar> requires (!CTensorOperand<TScalar>)
+	constexpr auto operator*(const T& x, const TScalar& scalar)
+	{
+		using TExpr = decltype(_scp::toTensorExpr(x));
+		return _scp::TensorExprScalar<_scp::TensorExprMul, TExpr, TScalar>(_scp::toTensorExpr(x), scalar);
+	}
+
+	template<typename TScalar, CTensorOperand T> requires (!CTensorOperand<TScalar>)
+	constexpr auto operator*(const TScalar& scalar, const T& x)
+	{
+		using TExpr = decltype(_scp::toTensorExpr(x));
+		return _scp::TensorExprScalar<_scp::TensorExprMul, TExpr, TScalar>(_scp::toTensorExpr(x), scalar);
+	}
+
+	template<CTensorOperand T, typename TScalar> requires (!CTensorOperand<TScalar>)
+	constexpr auto operator/(const T& x, const TScalar& scalar)
+	{
+		using TExpr = decltype(_scp::toTensorExpr(x));
+		return _scp::TensorExprScalar<_scp::TensorExprDiv, TExpr, TScalar>(_scp::toTensorExpr(x), scalar);
+	}
+
+	template<CTensorOperand T>
+	constexpr auto operator-(const T& x)
+	{
+		using TExpr = decltype(_scp::toTensorExpr(x));
+		return _scp::TensorExprUnary<_scp::TensorExprNeg, TExpr>(_scp::toTensorExpr(x));
+	}
+
+	template<CTensorOperand T>
+	constexpr auto operator+(const T& x)
+	{
+		return _scp::toTensorExpr(x);
+	}
+
+	template<CTensorOperand T>
+	constexpr auto eval(const T& operand)
+	{
+		using TExpr = decltype(_scp::toTensorExpr(operand));
+		return typename TExpr::DenseType(_scp::toTensorExpr(operand));
+	}
+
+	template<CTensorOperand TA, CTensorOperand TB> requires (CTensorExpr<TA> || CTensorExpr<TB>) && std::same_as<typename TA::ValueType, typename TB::ValueType>
+	constexpr auto operator*(const TA& a, const TB& b)
+	{
+		const auto evalOperand = []<CTensorOperand T>(const T& operand) -> decltype(auto)
+		{
+			if constexpr (CTensorExpr<T>)
+			{
+				return eval(operand);
+			}
+			else
+			{
+				return (operand);
+			}
+		};
+
+		return evalOperand(a) * evalOperand(b);
+	}
+}
@@ -11,13 +11,122 @@
 
 namespace scp
 {
+	namespace _scp
+	{
+		template<uint64_t Order, bool WithOffset, typename TFunc>
+		constexpr void forEachIndexOfOrder(uint64_t order, const uint64_t* sizes, const int64_t* strides, uint64_t begin, uint64_t end, TFunc& func)
+		{
+			if (begin == end)
+			{
+				return;
+			}
+
+			const uint64_t n = (Order == 0) ? order : Order;
+			assert(n == order);
+
+			// Orders unknown at compile time keep their indices on the stack too
+
+			std::array<uint64_t, Order> fixedIndices;
+			uint64_t* const indices = (Order == 0) ? reinterpret_cast<uint64_t*>(alloca(n * sizeof(uint64_t))) : fixedIndices.data();
+
+			const TensorShape shape{ n, const_cast<uint64_t*>(sizes) };
+			shape.getIndices(begin, indices);
+
+			int64_t offset = 0;
+			if constexpr (WithOffset)
+			{
+				for (uint64_t i = 0; i < n; ++i)
+				{
+					offset += static_cast<int64_t>(indices[i]) * strides[i];
+				}
+			}
+
+			const uint64_t rowSize = sizes[n - 1];
+			const int64_t rowStride = WithOffset ? strides[n - 1] : 0;
+
+			uint64_t index = begin;
+			while (true)
+			{
+				const uint64_t rowEnd = std::min(end, index + rowSize - indices[n - 1]);
+				for (; index < rowEnd; ++index, ++indices[n - 1])
+				{
+					if constexpr (WithOffset)
+					{
+						func(static_cast<const uint64_t*>(indices), index, offset);
+						offset += rowStride;
+					}
+					else
+					{
+						func(static_cast<const uint64_t*>(indices), index);
+					}
+				}
+
+				if (index == end)
+				{
+					break;
+				}
+
+				// Carry to the previous axes, the end being before the last element ensures one of them is not at its end
+
+				indices[n - 1] = 0;
+				if constexpr (WithOffset)
+				{
+					offset -= rowStride * static_cast<int64_t>(rowSize);
+				}
+
+				for (uint64_t i = n - 1; i-- > 0;)
+				{
+					++indices[i];
+					if constexpr (WithOffset)
+					{
+						offset += strides[i];
+					}
+
+					if (indices[i] != sizes[i])
+					{
+						break;
+					}
+
+					indices[i] = 0;
+					if constexpr (WithOffset)
+					{
+						offset -= strides[i] * static_cast<int64_t>(sizes[i]);
+					}
+				}
+			}
+		}
+
+		template<bool WithOffset, typename TFunc>
+		constexpr void forEachIndex(uint64_t order, const uint64_t* sizes, const int64_t* strides, uint64_t begin, uint64_t end, TFunc& func)
+		{
+			switch (order)
+			{
+				case 1:
+					forEachIndexOfOrder<1, WithOffset>(order, sizes, strides, begin, end, func);
+					break;
+				case 2:
+					forEachIndexOfOrder<2, WithOffset>(order, sizes, strides, begin, end, func);
+					break;
+				case 3:
+					forEachIndexOfOrder<3, WithOffset>(order, sizes, strides, begin, end, func);
+					break;
+				case 4:
+					forEachIndexOfOrder<4, WithOffset>(order, sizes, strides, begin, end, func);
+					break;
+				default:
+					forEachIndexOfOrder<0, WithOffset>(order, sizes, strides, begin, end, func);
+					break;
+			}
+		}
+	}
+
 	constexpr TensorShapeIterator::TensorShapeIterator(const TensorShape* shape, bool end) :
 		_shape(shape),
 		_pos{ 0, nullptr }
 	{
 		assert(_shape);
 
-		_pos.indices = new uint64_t[_shape->order];
+		_allocate();
 		std::fill_n(_pos.indices, _shape->order, 0);
 
 		if (end)
@@ -27,30 +136,61 @@ namespace scp
 		}
 	}
 
+	constexpr TensorShapeIterator::TensorShapeIterator(const TensorShape* shape, uint64_t index) :
+		_shape(shape),
+		_pos{ index, nullptr }
+	{
+		assert(_shape);
+		assert(index <= _shape->getElementCount());
+
+		_allocate();
+
+		if (index == _shape->getElementCount())
+		{
+			std::fill_n(_pos.indices, _shape->order, 0);
+			_pos.indices[0] = _shape->sizes[0];
+		}
+		else
+		{
+			_shape->getIndices(index, _pos.indices);
+		}
+	}
+
 	constexpr TensorShapeIterator::TensorShapeIterator(const TensorShapeIterator& iterator) :
 		_shape(iterator._shape),
 		_pos{ iterator._pos.index, nullptr }
 	{
-		_pos.indices = new uint64_t[_shape->order];
+		_allocate();
 		std::copy_n(iterator._pos.indices, _shape->order, _pos.indices);
 	}
 
 	constexpr TensorShapeIterator::TensorShapeIterator(TensorShapeIterator&& iterator) :
 		_shape(iterator._shape),
-		_pos{ iterator._pos.index, iterator._pos.indices }
+		_pos{ iterator._pos.index, nullptr }
 	{
-		iterator._pos.indices = nullptr;
+		if (iterator._pos.indices == iterator._buffer)
+		{
+			_allocate();
+			std::copy_n(iterator._pos.indices, _shape->order, _pos.indices);
+		}
+		else
+		{
+			_pos.indices = iterator._pos.indices;
+			iterator._pos.indices = nullptr;
+		}
 	}
 
 	constexpr TensorShapeIterator& TensorShapeIterator::operator=(const TensorShapeIterator& iterator)
 	{
-		if (_shape->order != iterator._shape->order)
+		if (this == &iterator)
 		{
-			delete[] _pos.indices;
-			_pos.indices = new uint64_t[iterator._shape->order];
+			return *this;
 		}
 
+		_deallocate();
+
 		_shape = iterator._shape;
+		_allocate();
 		std::copy_n(iterator._pos.indices, _shape->order, _pos.indices);
 		_pos.index = iterator._pos.index;
 
@@ -59,13 +199,26 @@ namespace scp
 	
 	constexpr TensorShapeIterator& TensorShapeIterator::operator=(TensorShapeIterator&& iterator)
 	{
-		delete[] _pos.indices;
+		if (this == &iterator)
+		{
+			return *this;
+		}
+
+		_deallocate();
 
 		_shape = iterator._shape;
 		_pos.index = iterator._pos.index;
-		_pos.indices = iterator._pos.indices;
 
-		iterator._pos.indices = nullptr;
+		if (iterator._pos.indices == iterator._buffer)
+		{
+			_allocate();
+			std::copy_n(iterator._pos.indices, _shape->order, _pos.indices);
+		}
+		else
+		{
+			_pos.indices = iterator._pos.indices;
+			iterator._pos.indices = nullptr;
+		}
 
 		return *this;
 	}
@@ -106,10 +259,22 @@ namespace scp
 
 	constexpr TensorShapeIterator::~TensorShapeIterator()
 	{
-		if (_pos.indices)
+		_deallocate();
+	}
+
+	constexpr void TensorShapeIterator::_allocate()
+	{
+		_pos.indices = (_shape->order <= _inlineOrder) ? _buffer : new uint64_t[_shape->order];
+	}
+
+	constexpr void TensorShapeIterator::_deallocate()
+	{
+		if (_pos.indices != _buffer)
 		{
 			delete[] _pos.indices;
 		}
+
+		_pos.indices = nullptr;
 	}
 
 	constexpr uint64_t TensorShape::getIndex(const uint64_t* indices) const
@@ -152,6 +317,26 @@ namespace scp
 		return std::accumulate(sizes, sizes + order, 1, std::multiplies<uint64_t>());
 	}
 
+	template<typename TFunc>
+	constexpr void TensorShape::forEach(TFunc&& func) const
+	{
+		_scp::forEachIndex<false>(order, sizes, nullptr, 0, getElementCount(), func);
+	}
+
+	template<typename TFunc>
+	constexpr void TensorShape::forEach(uint64_t begin, uint64_t end, TFunc&& func) const
+	{
+		assert(begin <= end && end <= getElementCount());
+		_scp::forEachIndex<false>(order, sizes, nullptr, begin, end, func);
+	}
+
+	template<typename TFunc>
+	constexpr void TensorShape::forEach(uint64_t begin, uint64_t end, const int64_t* strides, TFunc&& func) const
+	{
+		assert(begin <= end && end <= getElementCount());
+		_scp::forEachIndex<true>(order, sizes, strides, begin, end, func);
+	}
+
 	constexpr TensorShapeIterator TensorShape::begin() const
 	{
 		return TensorShapeIterator(this, false);
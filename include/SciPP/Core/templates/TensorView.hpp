@@ -0,0 +1,578 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//! \file
+//! \author Plgrin Marius
+//! \copyright The MIT License (MIT)
+//! \date 2019-2024
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <SciPP/Core/CoreDecl.hpp>
+
+namespace scp
+{
+	template<typename TValue>
+	constexpr TensorView<TValue>::TensorView(Tensor<ValueType>& tensor) :
+		_shape{ tensor.getOrder(), new uint64_t[tensor.getOrder()] },
+		_strides(new int64_t[tensor.getOrder()]),
+		_length(tensor.getElementCount()),
+		_values(tensor.getData()),
+		_contiguous(true)
+	{
+		std::copy_n(tensor.getSizes(), _shape.order, _shape.sizes);
+
+		int64_t stride = 1;
+		for (uint64_t i = _shape.order; i != 0; --i)
+		{
+			_strides[i - 1] = stride;
+			stride *= _shape.sizes[i - 1];
+		}
+	}
+
+	template<typename TValue>
+	constexpr TensorView<TValue>::TensorView(const Tensor<ValueType>& tensor) requires std::is_const_v<TValue> :
+		_shape{ tensor.getOrder(), new uint64_t[tensor.getOrder()] },
+		_strides(new int64_t[tensor.getOrder()]),
+		_length(tensor.getElementCount()),
+		_values(tensor.getData()),
+		_contiguous(true)
+	{
+		std::copy_n(tensor.getSizes(), _shape.order, _shape.sizes);
+
+		int64_t stride = 1;
+		for (uint64_t i = _shape.order; i != 0; --i)
+		{
+			_strides[i - 1] = stride;
+			stride *= _shape.sizes[i - 1];
+		}
+	}
+
+	template<typename TValue>
+	constexpr TensorView<TValue>::TensorView(uint64_t order, const uint64_t* sizes, const int64_t* strides, TValue* memory) :
+		_shape{ order, new uint64_t[order] },
+		_strides(new int64_t[order]),
+		_length(std::accumulate(sizes, sizes + order, uint64_t(1), std::multiplies<uint64_t>())),
+		_values(memory),
+		_contiguous(true)
+	{
+		assert(order != 0);
+		assert(std::find(sizes, sizes + order, 0) == sizes + order);
+		assert(memory);
+
+		std::copy_n(sizes, order, _shape.sizes);
+		std::copy_n(strides, order, _strides);
+
+		int64_t stride = 1;
+		for (uint64_t i = order; i != 0; --i)
+		{
+			if (sizes[i - 1] != 1 && strides[i - 1] != stride)
+			{
+				_contiguous = false;
+				break;
+			}
+
+			stride *= sizes[i - 1];
+		}
+	}
+
+	template<typename TValue>
+	constexpr TensorView<TValue>::TensorView(const std::initializer_list<uint64_t>& sizes, const std::initializer_list<int64_t>& strides, TValue* memory) :
+		TensorView<TValue>(sizes.size(), sizes.begin(), strides.begin(), memory)
+	{
+		assert(sizes.size() == strides.size());
+	}
+
+	template<typename TValue>
+	constexpr TensorView<TValue>::TensorView(const TensorView<ValueType>& view) requires std::is_const_v<TValue> :
+		TensorView<TValue>(view.getOrder(), view.getSizes(), view.getStrides(), view.getData())
+	{
+	}
+
+	template<typename TValue>
+	constexpr TensorView<TValue>::TensorView(const TensorView<TValue>& view) :
+		_shape{ view._shape.order, new uint64_t[view._shape.order] },
+		_strides(new int64_t[view._shape.order]),
+		_length(view._length),
+		_values(view._values),
+		_contiguous(view._contiguous)
+	{
+		std::copy_n(view._shape.sizes, _shape.order, _shape.sizes);
+		std::copy_n(view._strides, _shape.order, _strides);
+	}
+
+	template<typename TValue>
+	constexpr TensorView<TValue>::TensorView(TensorView<TValue>&& view) :
+		_shape(view._shape),
+		_strides(view._strides),
+		_length(view._length),
+		_values(view._values),
+		_contiguous(view._contiguous)
+	{
+		view._shape.sizes = nullptr;
+		view._strides = nullptr;
+	}
+
+	template<typename TValue>
+	constexpr TensorView<TValue>& TensorView<TValue>::operator=(const TensorView<TValue>& view)
+	{
+		return operator=<TensorView<TValue>>(view);
+	}
+
+	template<typename TValue>
+	template<CTensorOperand TOperand>
+	constexpr TensorView<TValue>& TensorView<TValue>::operator=(const TOperand& operand)
+	{
+		static_assert(!std::is_const_v<TValue>, "Cannot assign through a read-only view.");
+
+		const auto expr = _scp::toTensorExpr(operand);
+		assert(_shape.order == expr.getShape().order);
+		assert(std::equal(_shape.sizes, _shape.sizes + _shape.order, expr.getShape().sizes));
+
+		// Elements read after being written, as in v = v.transpose(0, 1), are evaluated beforehand
+
+		if (expr.aliases(_values, _shape, _strides))
+		{
+			return operator=(Tensor<ValueType>(expr));
+		}
+
+		_forEach([&](uint64_t index, TValue& value)
+		{
+			value = expr[index];
+		});
+
+		return *this;
+	}
+
+	template<typename TValue>
+	template<CTensorOperand TOperand>
+	constexpr TensorView<TValue>& TensorView<TValue>::operator+=(const TOperand& operand)
+	{
+		static_assert(!std::is_const_v<TValue>, "Cannot assign through a read-only view.");
+
+		const auto expr = _scp::toTensorExpr(operand);
+		assert(_shape.order == expr.getShape().order);
+		assert(std::equal(_shape.sizes, _shape.sizes + _shape.order, expr.getShape().sizes));
+
+		if (expr.aliases(_values, _shape, _strides))
+		{
+			return operator+=(Tensor<ValueType>(expr));
+		}
+
+		_forEach([&](uint64_t index, TValue& value)
+		{
+			value += expr[index];
+		});
+
+		return *this;
+	}
+
+	template<typename TValue>
+	template<CTensorOperand TOperand>
+	constexpr TensorView<TValue>& TensorView<TValue>::operator-=(const TOperand& operand)
+	{
+		static_assert(!std::is_const_v<TValue>, "Cannot assign through a read-only view.");
+
+		const auto expr = _scp::toTensorExpr(operand);
+		assert(_shape.order == expr.getShape().order);
+		assert(std::equal(_shape.sizes, _shape.sizes + _shape.order, expr.getShape().sizes));
+
+		if (expr.aliases(_values, _shape, _strides))
+		{
+			return operator-=(Tensor<ValueType>(expr));
+		}
+
+		_forEach([&](uint64_t index, TValue& value)
+		{
+			value -= expr[index];
+		});
+
+		return *this;
+	}
+
+	template<typename TValue>
+	template<typename TScalar> requires (!CTensorOperand<TScalar>)
+	constexpr TensorView<TValue>& TensorView<TValue>::operator*=(const TScalar& scalar)
+	{
+		static_assert(!std::is_const_v<TValue>, "Cannot assign through a read-only view.");
+
+		_forEach([&](uint64_t, TValue& value)
+		{
+			value *= scalar;
+		});
+
+		return *this;
+	}
+
+	template<typename TValue>
+	template<typename TScalar> requires (!CTensorOperand<TScalar>)
+	constexpr TensorView<TValue>& TensorView<TValue>::operator/=(const TScalar& scalar)
+	{
+		static_assert(!std::is_const_v<TValue>, "Cannot assign through a read-only view.");
+
+		_forEach([&](uint64_t, TValue& value)
+		{
+			value /= scalar;
+		});
+
+		return *this;
+	}
+
+	template<typename TValue>
+	constexpr TensorView<TValue> TensorView<TValue>::slice(uint64_t axis, uint64_t index) const
+	{
+		assert(_shape.order > 1);
+		assert(axis < _shape.order);
+		assert(index < _shape.sizes[axis]);
+
+		uint64_t* sizes = reinterpret_cast<uint64_t*>(alloca((_shape.order - 1) * sizeof(uint64_t)));
+		int64_t* strides = reinterpret_cast<int64_t*>(alloca((_shape.order - 1) * sizeof(int64_t)));
+
+		std::copy_n(_shape.sizes, axis, sizes);
+		std::copy(_shape.sizes + axis + 1, _shape.sizes + _shape.order, sizes + axis);
+		std::copy_n(_strides, axis, strides);
+		std::copy(_strides + axis + 1, _strides + _shape.order, strides + axis);
+
+		return TensorView<TValue>(_shape.order - 1, sizes, strides, _values + static_cast<int64_t>(index) * _strides[axis]);
+	}
+
+	template<typename TValue>
+	constexpr TensorView<TValue> TensorView<TValue>::range(uint64_t axis, uint64_t begin, uint64_t end, uint64_t step) const
+	{
+		assert(axis < _shape.order);
+		assert(begin < end && end <= _shape.sizes[axis]);
+		assert(step != 0);
+
+		int64_t* strides = reinterpret_cast<int64_t*>(alloca(_shape.order * sizeof(int64_t)));
+		uint64_t* sizes = reinterpret_cast<uint64_t*>(alloca(_shape.order * sizeof(uint64_t)));
+
+		std::copy_n(_shape.sizes, _shape.order, sizes);
+		std::copy_n(_strides, _shape.order, strides);
+
+		sizes[axis] = (end - begin + step - 1) / step;
+		strides[axis] *= static_cast<int64_t>(step);
+
+		return TensorView<TValue>(_shape.order, sizes, strides, _values + static_cast<int64_t>(begin) * _strides[axis]);
+	}
+
+	template<typename TValue>
+	constexpr TensorView<TValue> TensorView<TValue>::block(const uint64_t* begins, const uint64_t* sizes) const
+	{
+		int64_t offset = 0;
+		for (uint64_t i = 0; i < _shape.order; ++i)
+		{
+			assert(sizes[i] != 0 && begins[i] + sizes[i] <= _shape.sizes[i]);
+			offset += static_cast<int64_t>(begins[i]) * _strides[i];
+		}
+
+		return TensorView<TValue>(_shape.order, sizes, _strides, _values + offset);
+	}
+
+	template<typename TValue>
+	constexpr TensorView<TValue> TensorView<TValue>::block(const std::initializer_list<uint64_t>& begins, const std::initializer_list<uint64_t>& sizes) const
+	{
+		assert(begins.size() == _shape.order);
+		assert(sizes.size() == _shape.order);
+		return block(begins.begin(), sizes.begin());
+	}
+
+	template<typename TValue>
+	constexpr TensorView<TValue> TensorView<TValue>::transpose(uint64_t i, uint64_t j) const
+	{
+		assert(i < _shape.order);
+		assert(j < _shape.order);
+
+		// Built through the strided constructor, which checks contiguity again: swapping a size-1 axis keeps the
+		// layout only if all the axes in between have size 1 too
+
+		uint64_t* sizes = reinterpret_cast<uint64_t*>(alloca(_shape.order * sizeof(uint64_t)));
+		int64_t* strides = reinterpret_cast<int64_t*>(alloca(_shape.order * sizeof(int64_t)));
+
+		std::copy_n(_shape.sizes, _shape.order, sizes);
+		std::copy_n(_strides, _shape.order, strides);
+		std::swap(sizes[i], sizes[j]);
+		std::swap(strides[i], strides[j]);
+
+		return TensorView<TValue>(_shape.order, sizes, strides, _values);
+	}
+
+	template<typename TValue>
+	constexpr TensorView<TValue> TensorView<TValue>::permute(const uint64_t* axes) const
+	{
+		uint64_t* sizes = reinterpret_cast<uint64_t*>(alloca(_shape.order * sizeof(uint64_t)));
+		int64_t* strides = reinterpret_cast<int64_t*>(alloca(_shape.order * sizeof(int64_t)));
+
+		for (uint64_t i = 0; i < _shape.order; ++i)
+		{
+			assert(axes[i] < _shape.order);
+			assert(std::count(axes, axes + _shape.order, axes[i]) == 1);
+
+			sizes[i] = _shape.sizes[axes[i]];
+			strides[i] = _strides[axes[i]];
+		}
+
+		return TensorView<TValue>(_shape.order, sizes, strides, _values);
+	}
+
+	template<typename TValue>
+	constexpr TensorView<TValue> TensorView<TValue>::permute(const std::initializer_list<uint64_t>& axes) const
+	{
+		assert(axes.size() == _shape.order);
+		return permute(axes.begin());
+	}
+
+	template<typename TValue>
+	constexpr TensorView<TValue> TensorView<TValue>::reshape(uint64_t order, const uint64_t* sizes) const
+	{
+		assert(_contiguous);
+		assert(std::accumulate(sizes, sizes + order, uint64_t(1), std::multiplies<uint64_t>()) == _length);
+
+		int64_t* strides = reinterpret_cast<int64_t*>(alloca(order * sizeof(int64_t)));
+
+		int64_t stride = 1;
+		for (uint64_t i = order; i != 0; --i)
+		{
+			strides[i - 1] = stride;
+			stride *= sizes[i - 1];
+		}
+
+		return TensorView<TValue>(order, sizes, strides, _values);
+	}
+
+	template<typename TValue>
+	constexpr TensorView<TValue> TensorView<TValue>::reshape(const std::initializer_list<uint64_t>& sizes) const
+	{
+		return reshape(sizes.size(), sizes.begin());
+	}
+
+	template<typename TValue>
+	constexpr TensorView<TValue> TensorView<TValue>::diagonal(uint64_t i, uint64_t j) const
+	{
+		assert(_shape.order > 1);
+		assert(i != j);
+		assert(i < _shape.order);
+		assert(j < _shape.order);
+
+		// Axis i walks along the diagonal, axis j is removed
+
+		uint64_t* sizes = reinterpret_cast<uint64_t*>(alloca((_shape.order - 1) * sizeof(uint64_t)));
+		int64_t* strides = reinterpret_cast<int64_t*>(alloca((_shape.order - 1) * sizeof(int64_t)));
+
+		for (uint64_t k = 0, l = 0; k < _shape.order; ++k)
+		{
+			if (k == i)
+			{
+				sizes[l] = std::min(_shape.sizes[i], _shape.sizes[j]);
+				strides[l] = _strides[i] + _strides[j];
+				++l;
+			}
+			else if (k != j)
+			{
+				sizes[l] = _shape.sizes[k];
+				strides[l] = _strides[k];
+				++l;
+			}
+		}
+
+		return TensorView<TValue>(_shape.order - 1, sizes, strides, _values);
+	}
+
+	template<typename TValue>
+	constexpr TValue& TensorView<TValue>::operator[](uint64_t index) const
+	{
+		return get(index);
+	}
+
+	template<typename TValue>
+	constexpr TValue& TensorView<TValue>::operator[](const std::initializer_list<uint64_t>& indices) const
+	{
+		return get(indices);
+	}
+
+	template<typename TValue>
+	constexpr TValue& TensorView<TValue>::get(uint64_t index) const
+	{
+		assert(index < _length);
+		return _values[_getOffset(index)];
+	}
+
+	template<typename TValue>
+	constexpr TValue& TensorView<TValue>::get(const uint64_t* indices) const
+	{
+		int64_t offset = 0;
+		for (uint64_t i = 0; i < _shape.order; ++i)
+		{
+			assert(indices[i] < _shape.sizes[i]);
+			offset += static_cast<int64_t>(indices[i]) * _strides[i];
+		}
+
+		return _values[offset];
+	}
+
+	template<typename TValue>
+	constexpr TValue& TensorView<TValue>::get(const std::initializer_list<uint64_t>& indices) const
+	{
+		assert(indices.size() == _shape.order);
+		return get(indices.begin());
+	}
+
+	template<typename TValue>
+	constexpr const TensorShape& TensorView<TValue>::getShape() const
+	{
+		return _shape;
+	}
+
+	template<typename TValue>
+	constexpr uint64_t TensorView<TValue>::getOrder() const
+	{
+		return _shape.order;
+	}
+
+	template<typename TValue>
+	constexpr const uint64_t* TensorView<TValue>::getSizes() const
+	{
+		return _shape.sizes;
+	}
+
+	template<typename TValue>
+	constexpr uint64_t TensorView<TValue>::getSize(uint64_t i) const
+	{
+		assert(i < _shape.order);
+		return _shape.sizes[i];
+	}
+
+	template<typename TValue>
+	constexpr const int64_t* TensorView<TValue>::getStrides() const
+	{
+		return _strides;
+	}
+
+	template<typename TValue>
+	constexpr int64_t TensorView<TValue>::getStride(uint64_t i) const
+	{
+		assert(i < _shape.order);
+		return _strides[i];
+	}
+
+	template<typename TValue>
+	constexpr uint64_t TensorView<TValue>::getElementCount() const
+	{
+		return _length;
+	}
+
+	template<typename TValue>
+	constexpr bool TensorView<TValue>::isContiguous() const
+	{
+		return _contiguous;
+	}
+
+	template<typename TValue>
+	constexpr TValue* TensorView<TValue>::getData() const
+	{
+		return _values;
+	}
+
+	template<typename TValue>
+	constexpr TensorView<TValue>::~TensorView()
+	{
+		delete[] _shape.sizes;
+		delete[] _strides;
+	}
+
+	template<typename TValue>
+	constexpr int64_t TensorView<TValue>::_getOffset(uint64_t index) const
+	{
+		if (_contiguous)
+		{
+			return static_cast<int64_t>(index);
+		}
+
+		int64_t offset = 0;
+		for (uint64_t i = _shape.order; i != 0; --i)
+		{
+			offset += static_cast<int64_t>(index % _shape.sizes[i - 1]) * _strides[i - 1];
+			index /= _shape.sizes[i - 1];
+		}
+
+		return offset;
+	}
+
+	template<typename TValue>
+	template<typename TFunc>
+	constexpr void TensorView<TValue>::_forEach(const TFunc& func) const
+	{
+		_scp::parallelFor(_length, [&](uint64_t begin, uint64_t end)
+		{
+			if (_contiguous)
+			{
+				for (uint64_t i = begin; i < end; ++i)
+				{
+					func(i, _values[i]);
+				}
+
+				return;
+			}
+
+			const uint64_t last = _shape.order - 1;
+
+			uint64_t* indices = reinterpret_cast<uint64_t*>(alloca(_shape.order * sizeof(uint64_t)));
+			_shape.getIndices(begin, indices);
+
+			int64_t offset = 0;
+			for (uint64_t i = 0; i < _shape.order; ++i)
+			{
+				offset += static_cast<int64_t>(indices[i]) * _strides[i];
+			}
+
+			for (uint64_t i = begin; i < end; ++i)
+			{
+				func(i, _values[offset]);
+
+				uint64_t k = last;
+				++indices[k];
+				offset += _strides[k];
+				while (indices[k] == _shape.sizes[k] && k != 0)
+				{
+					offset -= static_cast<int64_t>(_shape.sizes[k]) * _strides[k];
+					indices[k] = 0;
+					--k;
+					++indices[k];
+					offset += _strides[k];
+				}
+			}
+		});
+	}
+
+	namespace _scp
+	{
+		template<typename TValue>
+		constexpr TensorExprViewRef<TValue>::TensorExprViewRef(const TensorView<TValue>& view) :
+			_view(&view)
+		{
+		}
+
+		template<typename TValue>
+		constexpr const typename TensorExprViewRef<TValue>::ValueType& TensorExprViewRef<TValue>::operator[](uint64_t index) const
+		{
+			return _view->get(index);
+		}
+
+		template<typename TValue>
+		constexpr const TensorShape& TensorExprViewRef<TValue>::getShape() const
+		{
+			return _view->getShape();
+		}
+
+		template<typename TValue>
+		constexpr uint64_t TensorExprViewRef<TValue>::getElementCount() const
+		{
+			return _view->getElementCount();
+		}
+
+		template<typename TValue>
+		template<typename TOther>
+		constexpr bool TensorExprViewRef<TValue>::aliases(const TOther* values, const TensorShape& shape, const int64_t* strides) const
+		{
+			return elementsAlias(values, shape, strides, _view->getData(), _view->getShape(), _view->getStrides());
+		}
+	}
+}
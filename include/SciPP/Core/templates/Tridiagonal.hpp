@@ -0,0 +1,207 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//! \file
+//! \author Plgrin Marius
+//! \copyright The MIT License (MIT)
+//! \date 2019-2024
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <SciPP/Core/CoreDecl.hpp>
+
+namespace scp
+{
+	namespace _scp
+	{
+		template<typename TValue>
+		constexpr void tridiagonalFactorize(uint64_t size, const TValue* lower, const TValue* diagonal, const TValue* upper, const TValue& firstDiagonal, const TValue& lastDiagonal, TValue* upperFactors, TValue* reciprocals)
+		{
+			for (uint64_t i = 0; i < size; ++i)
+			{
+				TValue pivot = i == 0 ? firstDiagonal : (i == size - 1 ? lastDiagonal : diagonal[i]);
+				if (i != 0)
+				{
+					pivot -= lower[i] * upperFactors[i - 1];
+				}
+
+				assert(pivot != TValue(0));
+
+				reciprocals[i] = TValue(1) / pivot;
+				upperFactors[i] = upper[i] * reciprocals[i];
+			}
+		}
+
+		template<typename TValue>
+		constexpr void tridiagonalSolve(uint64_t size, const TValue* lower, const TValue* upperFactors, const TValue* reciprocals, TValue* x, uint64_t stride, uint64_t count)
+		{
+			for (uint64_t k = 0; k < count; ++k)
+			{
+				x[k] *= reciprocals[0];
+			}
+
+			for (uint64_t i = 1; i < size; ++i)
+			{
+				TValue* row = x + i * stride;
+				const TValue* previousRow = row - stride;
+
+				for (uint64_t k = 0; k < count; ++k)
+				{
+					row[k] = (row[k] - lower[i] * previousRow[k]) * reciprocals[i];
+				}
+			}
+
+			for (uint64_t i = size - 2; i != UINT64_MAX; --i)
+			{
+				TValue* row = x + i * stride;
+				const TValue* nextRow = row + stride;
+
+				for (uint64_t k = 0; k < count; ++k)
+				{
+					row[k] -= upperFactors[i] * nextRow[k];
+				}
+			}
+		}
+
+		template<typename TValue, typename TFunc>
+		constexpr void tridiagonalBatches(Tensor<TValue>& tensor, uint64_t axis, uint64_t costPerLine, const TFunc& func)
+		{
+			const TensorShape& shape = tensor.getShape();
+
+			assert(axis < shape.order);
+
+			const uint64_t size = shape.sizes[axis];
+			const uint64_t outerCount = std::accumulate(shape.sizes, shape.sizes + axis, uint64_t(1), std::multiplies<uint64_t>());
+			const uint64_t innerCount = std::accumulate(shape.sizes + axis + 1, shape.sizes + shape.order, uint64_t(1), std::multiplies<uint64_t>());
+
+			TValue* values = tensor.getData();
+
+			if (innerCount == 1)
+			{
+				// Each line is contiguous, so alone in its batch its recurrence would stall on every value: lines are
+				// interleaved by groups in a scratch buffer instead, to be eliminated together
+
+				constexpr uint64_t groupSize = 16;
+
+				parallelFor(outerCount, costPerLine, [&](uint64_t begin, uint64_t end)
+				{
+					ScratchBuffer<TValue> group(size * groupSize);
+					TValue* groupValues = group.getData();
+
+					for (; begin < end; begin += groupSize)
+					{
+						const uint64_t count = std::min(groupSize, end - begin);
+						TValue* lines = values + begin * size;
+
+						for (uint64_t k = 0; k < count; ++k)
+						{
+							for (uint64_t i = 0; i < size; ++i)
+							{
+								groupValues[i * count + k] = lines[k * size + i];
+							}
+						}
+
+						func(groupValues, count, count);
+
+						for (uint64_t k = 0; k < count; ++k)
+						{
+							for (uint64_t i = 0; i < size; ++i)
+							{
+								lines[k * size + i] = groupValues[i * count + k];
+							}
+						}
+					}
+				});
+
+				return;
+			}
+
+			parallelFor(outerCount * innerCount, costPerLine, [&](uint64_t begin, uint64_t end)
+			{
+				while (begin != end)
+				{
+					const uint64_t outer = begin / innerCount;
+					const uint64_t inner = begin % innerCount;
+					const uint64_t count = std::min(end - begin, innerCount - inner);
+
+					func(values + outer * size * innerCount + inner, innerCount, count);
+
+					begin += count;
+				}
+			});
+		}
+	}
+
+	template<typename TValue>
+	constexpr void solveTridiagonal(const Vector<TValue>& lower, const Vector<TValue>& diagonal, const Vector<TValue>& upper, Tensor<TValue>& tensor, uint64_t axis)
+	{
+		const uint64_t size = diagonal.getSize(0);
+
+		assert(lower.getSize(0) == size && upper.getSize(0) == size);
+		assert(axis < tensor.getOrder() && tensor.getSize(axis) == size);
+
+		_scp::ScratchBuffer<TValue> upperFactors(size);
+		_scp::ScratchBuffer<TValue> reciprocals(size);
+		_scp::tridiagonalFactorize(size, lower.getData(), diagonal.getData(), upper.getData(), diagonal[0], diagonal[size - 1], upperFactors.getData(), reciprocals.getData());
+
+		_scp::tridiagonalBatches(tensor, axis, 5 * size, [&](TValue* x, uint64_t stride, uint64_t count)
+		{
+			_scp::tridiagonalSolve(size, lower.getData(), upperFactors.getData(), reciprocals.getData(), x, stride, count);
+		});
+	}
+
+	template<typename TValue>
+	constexpr void solveCyclicTridiagonal(const Vector<TValue>& lower, const Vector<TValue>& diagonal, const Vector<TValue>& upper, Tensor<TValue>& tensor, uint64_t axis)
+	{
+		const uint64_t size = diagonal.getSize(0);
+
+		assert(size >= 2);
+		assert(lower.getSize(0) == size && upper.getSize(0) == size);
+		assert(axis < tensor.getOrder() && tensor.getSize(axis) == size);
+
+		// A = T + u.vT, with u = (gamma, 0, ..., 0, upper[n-1]) and v = (1, 0, ..., 0, lower[0] / gamma), T being
+		// tridiagonal with its first and last diagonal values changed accordingly. With T.y = b and T.z = u, the solution
+		// is x = y - (v.y / (1 + v.z)) z, where z only depends on the matrix.
+
+		const TValue gamma = -diagonal[0];
+		const TValue cornerRatio = lower[0] / gamma;
+
+		_scp::ScratchBuffer<TValue> upperFactors(size);
+		_scp::ScratchBuffer<TValue> reciprocals(size);
+		_scp::tridiagonalFactorize(size, lower.getData(), diagonal.getData(), upper.getData(), diagonal[0] - gamma, diagonal[size - 1] - cornerRatio * upper[size - 1], upperFactors.getData(), reciprocals.getData());
+
+		_scp::ScratchBuffer<TValue> correction(size);
+		std::fill_n(correction.getData(), size, TValue(0));
+		correction[0] = gamma;
+		correction[size - 1] = upper[size - 1];
+		_scp::tridiagonalSolve(size, lower.getData(), upperFactors.getData(), reciprocals.getData(), correction.getData(), 1, 1);
+
+		const TValue scale = TValue(1) / (TValue(1) + correction[0] + cornerRatio * correction[size - 1]);
+
+		_scp::tridiagonalBatches(tensor, axis, 9 * size, [&](TValue* x, uint64_t stride, uint64_t count)
+		{
+			_scp::tridiagonalSolve(size, lower.getData(), upperFactors.getData(), reciprocals.getData(), x, stride, count);
+
+			// The first and last rows give the factor of each line, so they are corrected last
+
+			TValue* firstRow = x;
+			TValue* lastRow = x + (size - 1) * stride;
+
+			for (uint64_t i = 1; i < size - 1; ++i)
+			{
+				TValue* row = x + i * stride;
+
+				for (uint64_t k = 0; k < count; ++k)
+				{
+					row[k] -= (firstRow[k] + cornerRatio * lastRow[k]) * scale * correction[i];
+				}
+			}
+
+			for (uint64_t k = 0; k < count; ++k)
+			{
+				const TValue factor = (firstRow[k] + cornerRatio * lastRow[k]) * scale;
+				firstRow[k] -= factor * correction[0];
+				lastRow[k] -= factor * correction[size - 1];
+			}
+		});
+	}
+}
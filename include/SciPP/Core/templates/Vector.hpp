@@ -46,7 +46,7 @@ namespace scp
 	}
 
 	template<typename TValue>
-	constexpr Vector<TValue>::Vector(const std::initializer_list<TValue>& values) : Tensor<TValue>(1, values.size(), values.begin())
+	constexpr Vector<TValue>::Vector(const std::initializer_list<TValue>& values) : Vector<TValue>(values.size(), values.begin())
 	{
 	}
 
@@ -61,192 +61,51 @@ namespace scp
 	}
 
 	template<typename TValue>
-	constexpr void Vector<TValue>::rightMatrixProduct(const Tensor<TValue>& vector, const Tensor<TValue>& matrix)
+	template<CTensorExpr TExpr>
+	constexpr Vector<TValue>::Vector(const TExpr& expr) : Tensor<TValue>(expr)
 	{
-		assert(vector._shape.order == 1);
-		assert(matrix._shape.order == 2);
-		assert(matrix._shape.sizes[0] == vector._shape.sizes[0]);
-		assert(matrix._shape.sizes[1] == _shape.sizes[0]);
-
-		std::fill_n(_values, _length, 0);
-
-		TValue* values = _values;
-		const TValue* vectorValues = vector._values;
-		const TValue* matrixValues = matrix._values;
-
-		const TValue* const valuesEnd = values + _length;
-		const TValue* const vectorValuesEnd = vectorValues + vector._length;
-		
-		for (; vectorValues != vectorValuesEnd; ++vectorValues)
-		{
-			for (; values != valuesEnd; ++values, ++matrixValues)
-			{
-				*values += (*vectorValues) * (*matrixValues);
-			}
-
-			values -= _length;
-		}
+		assert(_shape.order == 1);
 	}
 
 	template<typename TValue>
-	constexpr void Vector<TValue>::leftMatrixProduct(const Tensor<TValue>& matrix, const Tensor<TValue>& vector)
+	template<CTensorExpr TExpr>
+	constexpr Vector<TValue>& Vector<TValue>::operator=(const TExpr& expr)
 	{
-		assert(vector._shape.order == 1);
-		assert(matrix._shape.order == 2);
-		assert(matrix._shape.sizes[0] == _shape.sizes[0]);
-		assert(matrix._shape.sizes[1] == vector._shape.sizes[0]);
-
-		TValue* values = _values;
-		const TValue* vectorValues = vector._values;
-		const TValue* matrixValues = matrix._values;
-
-		const TValue* const valuesEnd = values + _length;
-		const TValue* const vectorValuesEnd = vectorValues + vector._length;
+		assert(expr.getShape().order == 1);
 
-		for (; values != valuesEnd; ++values)
-		{
-			*values = 0;
+		Tensor<TValue>::operator=(expr);
 
-			for (; vectorValues != vectorValuesEnd; ++vectorValues, ++matrixValues)
-			{
-				*values += (*vectorValues) * (*matrixValues);
-			}
-
-			vectorValues -= vector._length;
-		}
-	}
-
-
-	template<typename TValue>
-	constexpr Vector<TValue> operator+(const Vector<TValue>& vectorA, const Vector<TValue>& vectorB)
-	{
-		Vector<TValue> vectorC(vectorA);
-		vectorC += vectorB;
-		return vectorC;
-	}
-
-	template<typename TValue>
-	constexpr Vector<TValue>&& operator+(Vector<TValue>&& vectorA, const Vector<TValue>& vectorB)
-	{
-		vectorA += vectorB;
-		return std::forward(vectorA);
-	}
-
-	template<typename TValue>
-	constexpr Vector<TValue>&& operator+(const Vector<TValue>& vectorA, Vector<TValue>&& vectorB)
-	{
-		vectorB += vectorA;
-		return std::forward(vectorB);
-	}
-
-	template<typename TValue>
-	constexpr Vector<TValue>&& operator+(Vector<TValue>&& vectorA, Vector<TValue>&& vectorB)
-	{
-		vectorA += vectorB;
-		return std::forward(vectorA);
-	}
-
-	template<typename TValue>
-	constexpr Vector<TValue> operator-(const Vector<TValue>& vectorA, const Vector<TValue>& vectorB)
-	{
-		Vector<TValue> vectorC(vectorA);
-		vectorC -= vectorB;
-		return vectorC;
-	}
-
-	template<typename TValue>
-	constexpr Vector<TValue>&& operator-(Vector<TValue>&& vectorA, const Vector<TValue>& vectorB)
-	{
-		vectorA -= vectorB;
-		return std::forward(vectorA);
+		return *this;
 	}
 
 	template<typename TValue>
-	constexpr Vector<TValue>&& operator-(const Vector<TValue>& vectorA, Vector<TValue>&& vectorB)
-	{
-		vectorB -= vectorA;
-		vectorB.negate();
-		return std::forward(vectorB);
-	}
-
-	template<typename TValue>
-	constexpr Vector<TValue>&& operator-(Vector<TValue>&& vectorA, Vector<TValue>&& vectorB)
-	{
-		vectorA -= vectorB;
-		return std::forward(vectorA);
-	}
-
-	template<typename TValue, typename TScalar>
-	constexpr Vector<TValue> operator*(const Vector<TValue>& vector, const TScalar& scalar)
-	{
-		Vector<TValue> copy(vector);
-		copy *= scalar;
-		return copy;
-	}
-
-	template<typename TValue, typename TScalar>
-	constexpr Vector<TValue>&& operator*(Vector<TValue>&& vector, const TScalar& scalar)
-	{
-		vector *= scalar;
-		return std::forward(vector);
-	}
-
-	template<typename TValue, typename TScalar>
-	constexpr Vector<TValue> operator*(const TScalar& scalar, const Vector<TValue>& vector)
-	{
-		Vector<TValue> copy(vector);
-		copy *= scalar;
-		return copy;
-	}
-
-	template<typename TValue, typename TScalar>
-	constexpr Vector<TValue>&& operator*(const TScalar& scalar, Vector<TValue>&& vector)
+	constexpr void Vector<TValue>::rightMatrixProduct(const Tensor<TValue>& vector, const Tensor<TValue>& matrix)
 	{
-		vector *= scalar;
-		return std::forward(vector);
-	}
+		assert(vector._shape.order == 1);
+		assert(matrix._shape.order == 2);
+		assert(matrix._shape.sizes[0] == vector._shape.sizes[0]);
+		assert(matrix._shape.sizes[1] == _shape.sizes[0]);
 
-	template<typename TValue, typename TScalar>
-	constexpr Vector<TValue> operator/(const Vector<TValue>& vector, const TScalar& scalar)
-	{
-		Vector<TValue> copy(vector);
-		copy /= scalar;
-		return copy;
-	}
+		_detachValues();
 
-	template<typename TValue, typename TScalar>
-	constexpr Vector<TValue>&& operator/(Vector<TValue>&& vector, const TScalar& scalar)
-	{
-		vector /= scalar;
-		return std::forward(vector);
+		std::fill_n(_values, _length, 0);
+		_scp::gemm<TValue>(1, _length, vector._length, vector._values, vector._length, matrix._values, _length, _values, _length);
 	}
 
 	template<typename TValue>
-	constexpr Vector<TValue> operator-(const Vector<TValue>& vector)
+	constexpr void Vector<TValue>::leftMatrixProduct(const Tensor<TValue>& matrix, const Tensor<TValue>& vector)
 	{
-		Vector<TValue> copy(vector);
-		copy.negate();
-		return copy;
-	}
+		assert(vector._shape.order == 1);
+		assert(matrix._shape.order == 2);
+		assert(matrix._shape.sizes[0] == _shape.sizes[0]);
+		assert(matrix._shape.sizes[1] == vector._shape.sizes[0]);
 
-	template<typename TValue>
-	constexpr Vector<TValue>&& operator-(Vector<TValue>&& vector)
-	{
-		vector.negate();
-		return std::forward(vector);
-	}
+		_detachValues();
 
-	template<typename TValue>
-	constexpr Vector<TValue> operator+(const Vector<TValue>& vector)
-	{
-		return vector;
+		std::fill_n(_values, _length, 0);
+		_scp::gemm<TValue>(_length, 1, vector._length, matrix._values, vector._length, vector._values, 1, _values, 1);
 	}
 
-	template<typename TValue>
-	constexpr Vector<TValue>&& operator+(Vector<TValue>&& vector)
-	{
-		return std::forward(vector);
-	}
 
 	template<typename TValue>
 	Vector<TValue> operator*(const Vector<TValue>& vector, const Matrix<TValue>& matrix)